@@ -52,6 +52,12 @@
 
 #define HADRONS_A2AM_PARALLEL_IO
 
+// default for the double-buffered background I/O mode of
+// A2AMatrixBlockComputation (can be overridden in the constructor)
+#ifndef HADRONS_A2AM_ASYNC_IO
+#define HADRONS_A2AM_ASYNC_IO false
+#endif
+
 BEGIN_HADRONS_NAMESPACE
 
 // general A2A matrix set based on Eigen tensors and Grid-allocated memory
@@ -125,9 +131,30 @@ public:
                    std::string datasetName);
     template <template <class> class Vec, typename VecT>
     void load(Vec<VecT> &v, double *tRead = nullptr, GridBase *grid = nullptr, std::string datasetName="");
+    // I/O session: while open, the file, group, datasets and dataspaces are
+    // kept open between block writes, the file is flushed once on closing.
+    // Copies of this object share the same session.
+    void openSession(void);
+    void closeSession(void);
+    bool hasSession(void) const;
+private:
+#ifdef HAVE_HDF5
+    struct Session
+    {
+        std::unique_ptr<Hdf5Reader>            reader;
+        std::map<std::string, H5NS::DataSet>   dataset;
+        std::map<std::string, H5NS::DataSpace> dataspace;
+    };
+    void writeHyperslab(H5NS::DataSet &dataset, H5NS::DataSpace &dataspace,
+                        const T *data, const unsigned int i, const unsigned int j,
+                        const unsigned int blockSizei, const unsigned int blockSizej);
+#endif
 private:
     std::string  filename_{""}, dataname_{""};
     unsigned int nt_{0}, ni_{0}, nj_{0};
+#ifdef HAVE_HDF5
+    std::shared_ptr<Session> session_{nullptr};
+#endif
 };
 
 /******************************************************************************
@@ -153,7 +180,10 @@ public:
                               const unsigned int nstr,
                               const unsigned int blockSize,
                               const unsigned int cacheBlockSize,
-                              TimerArray *tArray = nullptr);
+                              TimerArray *tArray = nullptr,
+                              const bool asyncIo = HADRONS_A2AM_ASYNC_IO);
+    // destructor
+    ~A2AMatrixBlockComputation(void);
     // execution
     void execute(const std::vector<Field> &left, 
                  const std::vector<Field> &right,
@@ -162,15 +192,26 @@ public:
                  const FilenameFn &filenameFn,
                  const MetadataFn &metadataFn);
 private:
-    // I/O handler
+    // I/O handlers
+    void makeNodeIo(const unsigned int N_i, const unsigned int N_j,
+                    const FilenameFn &ionameFn, const FilenameFn &filenameFn,
+                    const MetadataFn &metadataFn);
+    void closeNodeIo(void);
     void saveBlock(const A2AMatrixSet<TIo> &m, IoHelper &h);
+    // asynchronous I/O, executed on the background thread: only plain HDF5 
+    // calls and no communication or TimerArray access, returns the time in us
+    double asyncSaveBlock(const A2AMatrixSet<TIo> m);
+    double waitAsyncIo(void);
 private:
-    TimerArray            *tArray_;
-    GridBase              *grid_;
-    unsigned int          orthogDim_, nt_, next_, nstr_, blockSize_, cacheBlockSize_;
-    Vector<T>             mCache_;
-    Vector<TIo>           mBuf_;
-    std::vector<IoHelper> nodeIo_;
+    TimerArray               *tArray_;
+    GridBase                 *grid_;
+    unsigned int             orthogDim_, nt_, next_, nstr_, blockSize_, cacheBlockSize_;
+    bool                     asyncIo_;
+    Vector<T>                mCache_;
+    std::vector<Vector<TIo>> mBuf_;
+    std::vector<IoHelper>    nodeIo_;
+    std::future<double>      ioTask_;
+    double                   ioBlockSize_{0.};
 };
 
 /******************************************************************************
@@ -180,46 +221,96 @@ class A2AContraction
 {
 public:
     // accTrMul(acc, a, b): acc += tr(a*b)
+    // the partial sums are reduced in a buffer rather than under a lock
     template <typename C, typename MatLeft, typename MatRight>
     static inline void accTrMul(C &acc, const MatLeft &a, const MatRight &b)
     {
         const int RowMajor = Eigen::RowMajor;
         const int ColMajor = Eigen::ColMajor;
+        std::vector<C> buf;
+
         if ((MatLeft::Options  == RowMajor) and
             (MatRight::Options == ColMajor))
         {
+            buf.resize(a.rows());
   	  thread_for(r,a.rows(),
             {
-                C tmp;
 #ifdef USE_MKL
-                dotuRow(tmp, r, a, b);
+                dotuRow(buf[r], r, a, b);
 #else
-                tmp = a.row(r).conjugate().dot(b.col(r));
+                buf[r] = a.row(r).conjugate().dot(b.col(r));
 #endif
-                thread_critical
-                {
-                    acc += tmp;
-                }
             });
         }
         else
 	  {
+            buf.resize(a.cols());
             thread_for(c,a.cols(),
             {
-                C tmp;
 #ifdef USE_MKL 
-                dotuCol(tmp, c, a, b);
+                dotuCol(buf[c], c, a, b);
 #else
-                tmp = a.col(c).conjugate().dot(b.row(c));
+                buf[c] = a.col(c).conjugate().dot(b.row(c));
 #endif
-                thread_critical
+            });
+        }
+        for (auto &x: buf)
+        {
+            acc += x;
+        }
+    }
+
+    // trMulBatch(res, a, n, b): res(k, t) = tr(a[k]*B_t) for k < n, where
+    // the column t of b holds the elements of B_t^T in the storage order of
+    // a[k]. All the traces are computed as a single product over the matrix
+    // elements, split in chunks reduced by each thread without locks.
+    template <typename MatRes, typename Mat, typename MatCol>
+    static inline void trMulBatch(MatRes &res, const std::vector<Mat> &a,
+                                  const unsigned int n, const MatCol &b)
+    {
+        typedef typename MatRes::Scalar C;
+        typedef Eigen::Matrix<C, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> Block;
+
+        const Eigen::Index size   = b.rows(), nt = b.cols(), blockSize = 1024;
+        const Eigen::Index nChunk = std::min(static_cast<Eigen::Index>(GridThread::GetThreads()),
+                                             (size + blockSize - 1)/blockSize);
+        std::vector<Block> part(nChunk);
+
+        if (a[0].size() != size)
+        {
+            HADRONS_ERROR(Size, "matrix size mismatch in batched trace");
+        }
+        thread_for(c, nChunk,
+        {
+            Eigen::Index start = c*size/nChunk, end = (c + 1)*size/nChunk;
+            Block        buf(n, blockSize);
+
+            part[c].setZero(n, nt);
+            for (Eigen::Index x = start; x < end; x += blockSize)
+            {
+                Eigen::Index l = std::min(blockSize, end - x);
+
+                for (unsigned int k = 0; k < n; ++k)
                 {
-                    acc += tmp;
+                    std::copy(a[k].data() + x, a[k].data() + x + l, &buf(k, 0));
                 }
-            });
+                part[c].noalias() += buf.leftCols(l)*b.middleRows(x, l);
+            }
+        });
+        res.setZero(n, nt);
+        for (auto &p: part)
+        {
+            res += p;
         }
     }
 
+    template <typename Mat, typename MatCol>
+    static inline double trMulBatchFlops(const std::vector<Mat> &a, 
+                                         const unsigned int n, const MatCol &b)
+    {
+        return n*b.cols()*accTrMulFlops(a[0], a[0]);
+    }
+
     template <typename MatLeft, typename MatRight>
     static inline double accTrMulFlops(const MatLeft &a, const MatRight &b)
     {
@@ -283,13 +374,134 @@ public:
                         res.data(), res.rows());
         }
     }
+
+    // mulTr(res, a, b): res = (a*b)^T, computed as b^T*a^T without copies
+    template <template <class, int...> class Mat, int... Opts>
+    static inline void mulTr(Mat<ComplexD, Opts...> &res, 
+                             const Mat<ComplexD, Opts...> &a, 
+                             const Mat<ComplexD, Opts...> &b)
+    {
+        static const ComplexD one(1., 0.), zero(0., 0.);
+        const int RowMajor = Eigen::RowMajor;
+        const int ColMajor = Eigen::ColMajor;
+
+        if ((res.rows() != b.cols()) or (res.cols() != a.rows()))
+        {
+            res.resize(b.cols(), a.rows());
+        }
+        if (Mat<ComplexD, Opts...>::Options == RowMajor)
+        {
+            cblas_zgemm(CblasRowMajor, CblasTrans, CblasTrans, b.cols(), a.rows(),
+                        a.cols(), &one, b.data(), b.cols(), a.data(), a.cols(), &zero,
+                        res.data(), res.cols());
+        }
+        else if (Mat<ComplexD, Opts...>::Options == ColMajor)
+        {
+            cblas_zgemm(CblasColMajor, CblasTrans, CblasTrans, b.cols(), a.rows(),
+                        a.cols(), &one, b.data(), b.rows(), a.data(), a.rows(), &zero,
+                        res.data(), res.rows());
+        }
+    }
+
+    template <template <class, int...> class Mat, int... Opts>
+    static inline void mulTr(Mat<ComplexF, Opts...> &res, 
+                             const Mat<ComplexF, Opts...> &a, 
+                             const Mat<ComplexF, Opts...> &b)
+    {
+        static const ComplexF one(1., 0.), zero(0., 0.);
+        const int RowMajor = Eigen::RowMajor;
+        const int ColMajor = Eigen::ColMajor;
+
+        if ((res.rows() != b.cols()) or (res.cols() != a.rows()))
+        {
+            res.resize(b.cols(), a.rows());
+        }
+        if (Mat<ComplexF, Opts...>::Options == RowMajor)
+        {
+            cblas_cgemm(CblasRowMajor, CblasTrans, CblasTrans, b.cols(), a.rows(),
+                        a.cols(), &one, b.data(), b.cols(), a.data(), a.cols(), &zero,
+                        res.data(), res.cols());
+        }
+        else if (Mat<ComplexF, Opts...>::Options == ColMajor)
+        {
+            cblas_cgemm(CblasColMajor, CblasTrans, CblasTrans, b.cols(), a.rows(),
+                        a.cols(), &one, b.data(), b.rows(), a.data(), a.rows(), &zero,
+                        res.data(), res.rows());
+        }
+    }
 #else
     template <typename Mat>
     static inline void mul(Mat &res, const Mat &a, const Mat &b)
     {
         res = a*b;
     }
+
+    // mulTr(res, a, b): res = (a*b)^T, computed as b^T*a^T without copies
+    template <typename Mat>
+    static inline void mulTr(Mat &res, const Mat &a, const Mat &b)
+    {
+        res.noalias() = b.transpose()*a.transpose();
+    }
 #endif
+    // mulBatch(res, a, b, n): res[k] = a[k]*b[k] for k < n, if there are at
+    // least as many products as threads they are distributed over threads, each
+    // one running a sequential GEMM (Eigen and MKL do not spawn threads inside a
+    // parallel region), otherwise they are run one after the other, each one
+    // using a threaded GEMM
+    template <typename Mat>
+    static inline void mulBatch(std::vector<Mat> &res, const std::vector<Mat> &a,
+                                const std::vector<Mat> &b, const unsigned int n)
+    {
+        std::vector<unsigned int> idx(n);
+
+        std::iota(idx.begin(), idx.end(), 0);
+        mulBatch(res, a, b, idx);
+    }
+
+    // mulBatch(res, a, b, idx, tr): same as above for the k in idx only, 
+    // the transposed products are computed if tr is true
+    template <typename Mat>
+    static inline void mulBatch(std::vector<Mat> &res, const std::vector<Mat> &a,
+                                const std::vector<Mat> &b, 
+                                const std::vector<unsigned int> &idx,
+                                const bool tr = false)
+    {
+        if (res.size() < a.size())
+        {
+            res.resize(a.size());
+        }
+        if (idx.size() < static_cast<size_t>(GridThread::GetThreads()))
+        {
+            for (auto k: idx)
+            {
+                if (tr)
+                {
+                    mulTr(res[k], a[k], b[k]);
+                }
+                else
+                {
+                    mul(res[k], a[k], b[k]);
+                }
+            }
+        }
+        else
+        {
+            thread_for(l, idx.size(),
+            {
+                unsigned int k = idx[l];
+
+                if (tr)
+                {
+                    mulTr(res[k], a[k], b[k]);
+                }
+                else
+                {
+                    mul(res[k], a[k], b[k]);
+                }
+            });
+        }
+    }
+
     template <typename Mat>
     static inline double mulFlops(const Mat &a, const Mat &b)
     {
@@ -500,27 +712,35 @@ void A2AMatrixIo<T>::saveBlock(const T *data,
                                std::string datasetName)
 {
 #ifdef HAVE_HDF5
-    Hdf5Reader           reader(filename_, false);
-    std::vector<hsize_t> count = {nt_, blockSizei, blockSizej},
-                         offset = {0, static_cast<hsize_t>(i),
-                                   static_cast<hsize_t>(j)},
-                         stride = {1, 1, 1},
-                         block  = {1, 1, 1}; 
-    H5NS::DataSpace      memspace(count.size(), count.data()), dataspace;
-    H5NS::DataSet        dataset;
-    //    size_t               shift;
-
     if(datasetName.empty()){
         datasetName = HADRONS_A2AM_NAME;
     }
 
-    push(reader, dataname_);
-    auto &group = reader.getGroup();
-    dataset     = group.openDataSet(datasetName);
-    dataspace   = dataset.getSpace();
-    dataspace.selectHyperslab(H5S_SELECT_SET, count.data(), offset.data(),
-                              stride.data(), block.data());
-    dataset.write(data, Hdf5Type<T>::type(), memspace, dataspace);
+    if (session_)
+    {
+        if (session_->dataset.find(datasetName) == session_->dataset.end())
+        {
+            auto &group = session_->reader->getGroup();
+
+            session_->dataset[datasetName]   = group.openDataSet(datasetName);
+            session_->dataspace[datasetName] = session_->dataset[datasetName].getSpace();
+        }
+        writeHyperslab(session_->dataset.at(datasetName), 
+                       session_->dataspace.at(datasetName),
+                       data, i, j, blockSizei, blockSizej);
+    }
+    else
+    {
+        Hdf5Reader      reader(filename_, false);
+        H5NS::DataSpace dataspace;
+        H5NS::DataSet   dataset;
+
+        push(reader, dataname_);
+        auto &group = reader.getGroup();
+        dataset     = group.openDataSet(datasetName);
+        dataspace   = dataset.getSpace();
+        writeHyperslab(dataset, dataspace, data, i, j, blockSizei, blockSizej);
+    }
 #else
     HADRONS_ERROR(Implementation, "all-to-all matrix I/O needs HDF5 library");
 #endif
@@ -539,17 +759,83 @@ void A2AMatrixIo<T>::saveBlock(const A2AMatrixSet<T> &m,
     saveBlock(m.data() + offset, i, j, blockSizei, blockSizej);
 }
 
+#ifdef HAVE_HDF5
+template <typename T>
+void A2AMatrixIo<T>::writeHyperslab(H5NS::DataSet &dataset, 
+                                    H5NS::DataSpace &dataspace,
+                                    const T *data,
+                                    const unsigned int i, 
+                                    const unsigned int j,
+                                    const unsigned int blockSizei,
+                                    const unsigned int blockSizej)
+{
+    std::vector<hsize_t> count = {nt_, blockSizei, blockSizej},
+                         offset = {0, static_cast<hsize_t>(i),
+                                   static_cast<hsize_t>(j)},
+                         stride = {1, 1, 1},
+                         block  = {1, 1, 1}; 
+    H5NS::DataSpace      memspace(count.size(), count.data());
+
+    dataspace.selectHyperslab(H5S_SELECT_SET, count.data(), offset.data(),
+                              stride.data(), block.data());
+    dataset.write(data, Hdf5Type<T>::type(), memspace, dataspace);
+}
+#endif
+
+// I/O session /////////////////////////////////////////////////////////////////
+template <typename T>
+void A2AMatrixIo<T>::openSession(void)
+{
+#ifdef HAVE_HDF5
+    if (!session_)
+    {
+        session_         = std::make_shared<Session>();
+        session_->reader.reset(new Hdf5Reader(filename_, false));
+        push(*session_->reader, dataname_);
+    }
+#else
+    HADRONS_ERROR(Implementation, "all-to-all matrix I/O needs HDF5 library");
+#endif
+}
+
+template <typename T>
+void A2AMatrixIo<T>::closeSession(void)
+{
+#ifdef HAVE_HDF5
+    if (session_)
+    {
+        H5Fflush(session_->reader->getGroup().getId(), H5F_SCOPE_GLOBAL);
+        // the file is closed when the last copy sharing the session resets
+        session_.reset();
+    }
+#endif
+}
+
+template <typename T>
+bool A2AMatrixIo<T>::hasSession(void) const
+{
+#ifdef HAVE_HDF5
+    return (session_ != nullptr);
+#else
+    return false;
+#endif
+}
+
 //distillation overloads and new methods
 template <typename T>
 void A2AMatrixIo<T>::createDilutionBlock(std::string datasetName, const unsigned int chunkSize, const std::vector<unsigned int> timeSlices)
 {
 #ifdef HAVE_HDF5
-    Hdf5Reader           reader(filename_, false);
-    H5NS::DataSpace      dataspace;
-    H5NS::DataSet        dataset;
+    std::unique_ptr<Hdf5Reader> reader;
+    H5NS::DataSpace             dataspace;
+    H5NS::DataSet               dataset;
 
-    push(reader, dataname_);
-    auto &group = reader.getGroup();
+    if (!session_)
+    {
+        reader.reset(new Hdf5Reader(filename_, false));
+        push(*reader, dataname_);
+    }
+    auto &group = (session_) ? session_->reader->getGroup() : reader->getGroup();
     unsigned int ntchunk = (nt_ > DISTIL_NT_CHUNK_SIZE) ? DISTIL_NT_CHUNK_SIZE : nt_;
     
     //creates new dataset with custom name and certain chunk
@@ -570,6 +856,11 @@ void A2AMatrixIo<T>::createDilutionBlock(std::string datasetName, const unsigned
     H5NS::DataSpace attrSpace(1, &attrDim);
     H5NS::Attribute attr = dataset.createAttribute("TimeSlices",  Hdf5Type<unsigned int>::type(), attrSpace);
     attr.write(Hdf5Type<unsigned int>::type(), timeSlices.data());
+    if (session_)
+    {
+        session_->dataset[datasetName]   = dataset;
+        session_->dataspace[datasetName] = dataspace;
+    }
 #else
     HADRONS_ERROR(Implementation, "all-to-all matrix I/O needs HDF5 library");
 #endif
@@ -712,13 +1003,31 @@ A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
                             const unsigned int nstr,
                             const unsigned int blockSize, 
                             const unsigned int cacheBlockSize,
-                            TimerArray *tArray)
+                            TimerArray *tArray,
+                            const bool asyncIo)
 : grid_(grid), nt_(grid->GlobalDimensions()[orthogDim]), orthogDim_(orthogDim)
 , next_(next), nstr_(nstr), blockSize_(blockSize), cacheBlockSize_(cacheBlockSize)
-, tArray_(tArray)
+, tArray_(tArray), asyncIo_(asyncIo)
 {
     mCache_.resize(nt_*next_*nstr_*cacheBlockSize_*cacheBlockSize_);
-    mBuf_.resize(nt_*next_*nstr_*blockSize_*blockSize_);
+    // second buffer for the block being written while the next one is computed
+    mBuf_.resize(asyncIo_ ? 2 : 1);
+    for (auto &b: mBuf_)
+    {
+        b.resize(nt_*next_*nstr_*blockSize_*blockSize_);
+    }
+}
+
+// destructor //////////////////////////////////////////////////////////////////
+template <typename T, typename Field, typename MetadataType, typename TIo>
+A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
+::~A2AMatrixBlockComputation(void)
+{
+    // never leave the I/O thread writing from a buffer about to be freed
+    if (ioTask_.valid())
+    {
+        ioTask_.wait();
+    }
 }
 
 #define START_TIMER(name) if (tArray_) tArray_->startTimer(name)
@@ -738,21 +1047,31 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
     // iii,jjj are loops within cacheBlock
     // Total index is sum of these  i+ii+iii etc...
     //////////////////////////////////////////////////////////////////////////
-    int    N_i = left.size();
-    int    N_j = right.size();
-    double flops, bytes, t_kernel;
-    double nodes = grid_->NodeCount();
+    int          N_i = left.size();
+    int          N_j = right.size();
+    double       flops, bytes, t_kernel;
+    double       nodes = grid_->NodeCount();
+    double       tCompute, tComputeTotal = 0., tIo, tIoTotal = 0., tStall, tStallTotal = 0.;
+    unsigned int buf = 0;
     
     int NBlock_i = N_i/blockSize_ + (((N_i % blockSize_) != 0) ? 1 : 0);
     int NBlock_j = N_j/blockSize_ + (((N_j % blockSize_) != 0) ? 1 : 0);
 
+    if (asyncIo_)
+    {
+        LOG(Message) << "Using double-buffered asynchronous HDF5 I/O" << std::endl;
+        makeFileDir(filenameFn(0, 0), grid_);
+        grid_->Barrier();
+    }
+    // task list for current node, files are kept open across blocks
+    makeNodeIo(N_i, N_j, ionameFn, filenameFn, metadataFn);
     for(int i=0;i<N_i;i+=blockSize_)
     for(int j=0;j<N_j;j+=blockSize_)
     {
         // Get the W and V vectors for this block^2 set of terms
         int N_ii = MIN(N_i-i,blockSize_);
         int N_jj = MIN(N_j-j,blockSize_);
-        A2AMatrixSet<TIo> mBlock(mBuf_.data(), next_, nstr_, nt_, N_ii, N_jj);
+        A2AMatrixSet<TIo> mBlock(mBuf_[buf].data(), next_, nstr_, nt_, N_ii, N_jj);
 
         LOG(Message) << "All-to-all matrix block " 
                      << j/blockSize_ + NBlock_j*i/blockSize_ + 1 
@@ -763,6 +1082,7 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
         flops    = 0.0;
         bytes    = 0.0;
         t_kernel = 0.0;
+        tCompute = -usecond();
         for(int ii=0;ii<N_ii;ii+=cacheBlockSize_)
         for(int jj=0;jj<N_jj;jj+=cacheBlockSize_)
         {
@@ -790,6 +1110,8 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
             });
             STOP_TIMER("cache copy");
         }
+        tCompute      += usecond();
+        tComputeTotal += tCompute;
 
         // perf
         LOG(Message) << "Kernel perf " << flops/t_kernel/1.0e3/nodes 
@@ -798,33 +1120,58 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
                      << " GB/s/node "  << std::endl;
 
         // IO
-        double       blockSize, ioTime;
-        unsigned int myRank = grid_->ThisRank(), nRank  = grid_->RankCount();
+        double blockSize, ioTime;
     
+        if (asyncIo_)
+        {
+            // the previous block was written while this one was computed,
+            // any remaining I/O time is a stall of the computation
+            if (ioTask_.valid())
+            {
+                double ioBlockSize = ioBlockSize_;
+
+                START_TIMER("IO: wait");
+                tStall       = -usecond();
+                tIo          = waitAsyncIo();
+                tStall      += usecond();
+                STOP_TIMER("IO: wait");
+                tIoTotal    += tIo;
+                tStallTotal += tStall;
+                LOG(Message) << "HDF5 IO done " << sizeString(ioBlockSize) << " in "
+                             << tIo  << " us (" 
+                             << ioBlockSize/tIo*1.0e6/1024/1024
+                             << " MB/s, asynchronous)" << std::endl;
+                LOG(Message) << "Compute/IO overlap " 
+                             << (1. - tStall/tIo)*100. << "% (compute "
+                             << tCompute << " us, IO " << tIo << " us, stall " 
+                             << tStall << " us)" << std::endl;
+            }
+            LOG(Message) << "Writing block to disk (asynchronous)" << std::endl;
+            START_TIMER("IO: total");
+            for (auto &h: nodeIo_)
+            {
+                h.i = i;
+                h.j = j;
+            }
+            ioBlockSize_ = static_cast<double>(next_*nstr_*nt_*N_ii*N_jj*sizeof(TIo));
+            ioTask_      = std::async(std::launch::async, 
+                                      &A2AMatrixBlockComputation::asyncSaveBlock,
+                                      this, mBlock);
+            STOP_TIMER("IO: total");
+            buf = (buf + 1) % mBuf_.size();
+            continue;
+        }
         LOG(Message) << "Writing block to disk" << std::endl;
         ioTime = -GET_TIMER("IO: write block");
         START_TIMER("IO: total");
         makeFileDir(filenameFn(0, 0), grid_);
 #ifdef HADRONS_A2AM_PARALLEL_IO
         grid_->Barrier();
-        // make task list for current node
-        nodeIo_.clear();
-        for(int f = myRank; f < next_*nstr_; f += nRank)
-        {
-            IoHelper h;
-
-            h.i  = i;
-            h.j  = j;
-            h.e  = f/nstr_;
-            h.s  = f % nstr_;
-            h.io = A2AMatrixIo<TIo>(filenameFn(h.e, h.s), 
-                                    ionameFn(h.e, h.s), nt_, N_i, N_j);
-            h.md = metadataFn(h.e, h.s);
-            nodeIo_.push_back(h);
-        }
         // parallel IO
         for (auto &h: nodeIo_)
         {
+            h.i = i;
+            h.j = j;
             saveBlock(mBlock, h);
         }
         grid_->Barrier();
@@ -853,9 +1200,75 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
                      << blockSize/ioTime*1.0e6/1024/1024
                      << " MB/s)" << std::endl;
     }
+    if (asyncIo_ and ioTask_.valid())
+    {
+        double ioBlockSize = ioBlockSize_;
+
+        // last block, nothing left to overlap with
+        START_TIMER("IO: wait");
+        tStall       = -usecond();
+        tIo          = waitAsyncIo();
+        tStall      += usecond();
+        STOP_TIMER("IO: wait");
+        tIoTotal    += tIo;
+        tStallTotal += tStall;
+        LOG(Message) << "HDF5 IO done " << sizeString(ioBlockSize) << " in "
+                     << tIo  << " us (" 
+                     << ioBlockSize/tIo*1.0e6/1024/1024
+                     << " MB/s, asynchronous)" << std::endl;
+        START_TIMER("IO: total");
+        closeNodeIo();
+        STOP_TIMER("IO: total");
+        grid_->Barrier();
+        LOG(Message) << "Compute/IO overlap total: compute " << tComputeTotal 
+                     << " us, IO " << tIoTotal << " us, stall " << tStallTotal 
+                     << " us (" << (1. - tStallTotal/tIoTotal)*100. 
+                     << "% of IO hidden)" << std::endl;
+    }
+    else
+    {
+        START_TIMER("IO: total");
+        closeNodeIo();
+        STOP_TIMER("IO: total");
+    }
+}
+
+// I/O handlers ////////////////////////////////////////////////////////////////
+template <typename T, typename Field, typename MetadataType, typename TIo>
+void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
+::makeNodeIo(const unsigned int N_i, const unsigned int N_j,
+             const FilenameFn &ionameFn, const FilenameFn &filenameFn,
+             const MetadataFn &metadataFn)
+{
+    unsigned int myRank = grid_->ThisRank(), nRank  = grid_->RankCount();
+
+    nodeIo_.clear();
+    for(int f = myRank; f < next_*nstr_; f += nRank)
+    {
+        IoHelper h;
+
+        h.i  = 0;
+        h.j  = 0;
+        h.e  = f/nstr_;
+        h.s  = f % nstr_;
+        h.io = A2AMatrixIo<TIo>(filenameFn(h.e, h.s), 
+                                ionameFn(h.e, h.s), nt_, N_i, N_j);
+        h.md = metadataFn(h.e, h.s);
+        nodeIo_.push_back(h);
+    }
+}
+
+template <typename T, typename Field, typename MetadataType, typename TIo>
+void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
+::closeNodeIo(void)
+{
+    for (auto &h: nodeIo_)
+    {
+        h.io.closeSession();
+    }
+    nodeIo_.clear();
 }
 
-// I/O handler /////////////////////////////////////////////////////////////////
 template <typename T, typename Field, typename MetadataType, typename TIo>
 void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
 ::saveBlock(const A2AMatrixSet<TIo> &m, IoHelper &h)
@@ -864,6 +1277,7 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
     {
         START_TIMER("IO: file creation");
         h.io.initFile(h.md, blockSize_);
+        h.io.openSession();
         STOP_TIMER("IO: file creation");
     }
     START_TIMER("IO: write block");
@@ -871,6 +1285,34 @@ void A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
     STOP_TIMER("IO: write block");
 }
 
+template <typename T, typename Field, typename MetadataType, typename TIo>
+double A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
+::asyncSaveBlock(const A2AMatrixSet<TIo> m)
+{
+    double t = -usecond();
+
+    for (auto &h: nodeIo_)
+    {
+        if ((h.i == 0) and (h.j == 0))
+        {
+            h.io.initFile(h.md, blockSize_);
+            h.io.openSession();
+        }
+        h.io.saveBlock(m, h.e, h.s, h.i, h.j);
+    }
+    t += usecond();
+
+    return t;
+}
+
+template <typename T, typename Field, typename MetadataType, typename TIo>
+double A2AMatrixBlockComputation<T, Field, MetadataType, TIo>
+::waitAsyncIo(void)
+{
+    // get() rethrows any exception raised on the I/O thread
+    return ioTask_.get();
+}
+
 #undef START_TIMER
 #undef STOP_TIMER
 #undef GET_TIMER
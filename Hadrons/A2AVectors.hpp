@@ -60,6 +60,19 @@ public:
     void makeHighModeW(FermionField &wout, const FermionField &noise);
     void makeHighModeW5D(FermionField &vout_5d, FermionField &wout_5d, 
                          const FermionField &noise_5d);
+    // V and W low modes in a single pass, sharing the common operators
+    void makeLowModeVW(FermionField &vout, FermionField &wout,
+                       const FermionField &evec, const Real &eval);
+    void makeLowModeVW5D(FermionField &vout_4d, FermionField &wout_4d, 
+                         FermionField &tmp_5d, const FermionField &evec, 
+                         const Real &eval);
+    // batched high modes, the solves are dispatched to the vector solver
+    void makeHighModeV(std::vector<FermionField> &vout, 
+                       const std::vector<FermionField> &noise);
+    void makeHighModeV5D(std::vector<FermionField> &vout_4d, 
+                         std::vector<FermionField> &vout_5d,
+                         std::vector<FermionField> &src_5d,
+                         const std::vector<FermionField> &noise);
 private:
     FMat                                     &action_;
     Solver                                   &solver_;
@@ -295,6 +308,94 @@ void A2AVectorsSchurDiagTwo<FImpl>::makeHighModeW5D(FermionField &wout_4d,
     }
 }
 
+template <typename FImpl>
+void A2AVectorsSchurDiagTwo<FImpl>::makeLowModeVW(FermionField &vout, 
+                                                  FermionField &wout,
+                                                  const FermionField &evec, 
+                                                  const Real &eval)
+{
+    src_o_ = evec;
+    src_o_.Checkerboard() = Odd;
+    pickCheckerboard(Even, sol_e_, vout);
+    pickCheckerboard(Odd, sol_o_, vout);
+
+    /////////////////////////////////////////////////////
+    // v_io = (1/eval_i) * MooInv evec_i
+    // v_ie = -(1/eval_i) * MeeInv Meo MooInv evec_i
+    /////////////////////////////////////////////////////
+    action_.MooeeInv(src_o_, tmp_);
+    assert(tmp_.Checkerboard() == Odd);
+    sol_o_ = (1.0 / eval) * tmp_;
+    assert(sol_o_.Checkerboard() == Odd);
+    action_.Meooe(tmp_, sol_e_);
+    assert(sol_e_.Checkerboard() == Even);
+    action_.MooeeInv(sol_e_, tmp_);
+    assert(tmp_.Checkerboard() == Even);
+    sol_e_ = (-1.0 / eval) * tmp_;
+    assert(sol_e_.Checkerboard() == Even);
+    setCheckerboard(vout, sol_e_);
+    setCheckerboard(vout, sol_o_);
+
+    /////////////////////////////////////////////////////
+    // w_io = Doo evec_i
+    // w_ie = - MeeInvDag MoeDag Doo evec_i
+    /////////////////////////////////////////////////////
+    pickCheckerboard(Even, sol_e_, wout);
+    pickCheckerboard(Odd, sol_o_, wout);
+    op_.Mpc(src_o_, sol_o_);
+    assert(sol_o_.Checkerboard() == Odd);
+    action_.MeooeDag(sol_o_, sol_e_);
+    assert(sol_e_.Checkerboard() == Even);
+    action_.MooeeInvDag(sol_e_, tmp_);
+    assert(tmp_.Checkerboard() == Even);
+    sol_e_ = (-1.0) * tmp_;
+    setCheckerboard(wout, sol_e_);
+    setCheckerboard(wout, sol_o_);
+}
+
+template <typename FImpl>
+void A2AVectorsSchurDiagTwo<FImpl>::makeLowModeVW5D(FermionField &vout_4d, 
+                                                    FermionField &wout_4d,
+                                                    FermionField &tmp_5d,
+                                                    const FermionField &evec, 
+                                                    const Real &eval)
+{
+    makeLowModeVW(tmp_5d, tmp5_, evec, eval);
+    action_.ExportPhysicalFermionSolution(tmp_5d, vout_4d);
+    action_.DminusDag(tmp5_, tmp_5d);
+    action_.ExportPhysicalFermionSource(tmp_5d, wout_4d);
+}
+
+template <typename FImpl>
+void A2AVectorsSchurDiagTwo<FImpl>::makeHighModeV(std::vector<FermionField> &vout, 
+                                                  const std::vector<FermionField> &noise)
+{
+    solver_(vout, noise);
+}
+
+template <typename FImpl>
+void A2AVectorsSchurDiagTwo<FImpl>::makeHighModeV5D(std::vector<FermionField> &vout_4d, 
+                                                    std::vector<FermionField> &vout_5d,
+                                                    std::vector<FermionField> &src_5d,
+                                                    const std::vector<FermionField> &noise)
+{
+    for (unsigned int i = 0; i < noise.size(); ++i)
+    {
+        if (noise[i].Grid()->Dimensions() == fGrid_->Dimensions() - 1)
+        {
+            action_.ImportPhysicalFermionSource(noise[i], src_5d[i]);
+        }
+        else
+        {
+            src_5d[i] = noise[i];
+        }
+    }
+    makeHighModeV(vout_5d, src_5d);
+    for (unsigned int i = 0; i < noise.size(); ++i)
+    {
+        action_.ExportPhysicalFermionSolution(vout_5d[i], vout_4d[i]);
+    }
+}
 
 /******************************************************************************
  *               A2AVectorsLowStaggered template implementation             *
@@ -30,6 +30,7 @@
 #include <Hadrons/GeneticScheduler.hpp>
 #include <Hadrons/StatLogger.hpp>
 #include <Hadrons/Modules.hpp>
+#include <unistd.h>
 
 using namespace Grid;
 using namespace Hadrons;
@@ -121,6 +122,11 @@ void Application::setPar(const Application::GlobalPar &par)
             scheduled_      = true;
             LOG(Message) << "Schedule restored from application database" << std::endl;
         }
+        if (getPar().database.resume)
+        {
+            vm().setResume(true);
+            LOG(Message) << "Completed modules will be skipped (resume mode)" << std::endl;
+        }
     }
     if (!getPar().database.resultDb.empty())
     {
@@ -180,6 +186,10 @@ void Application::run(void)
     LOG(Message) << "Attempt(s) for resilient parallel I/O: " 
                  << BinaryIO::latticeWriteMaxRetry << std::endl;
     vm().setRunId(getPar().runId);
+    if (getPar().database.resume and getPar().database.applicationDb.empty())
+    {
+        HADRONS_ERROR(Definition, "resume mode needs an application database");
+    }
     if (!getPar().database.statDbBase.empty())
     {
         std::string        statDbFilename;
@@ -208,6 +218,10 @@ void Application::run(void)
         {
             naiveSchedule();
         }
+        else if (getPar().scheduler.schedulerType == "critical")
+        {
+            criticalPathSchedule();
+        }
         else
         {
             HADRONS_ERROR(Parsing, "Unkown scheduler '"
@@ -322,6 +336,17 @@ void Application::naiveSchedule(void)
     }
 }
 
+void Application::criticalPathSchedule(void)
+{
+    if (!scheduled_ and !loadedSchedule_)
+    {
+        VirtualMachine::Size budget = par_.scheduler.memoryBudgetMB;
+
+        program_   = vm().criticalPathSchedule(budget*1024*1024);
+        scheduled_ = true;
+    }
+}
+
 void Application::saveSchedule(const std::string filename)
 {
     LOG(Message) << "Saving current schedule to '" << filename << "'..."
@@ -387,17 +412,91 @@ void Application::printSchedule(void)
     }
 }
 
+// prefetch the input files of a trajectory on a background thread ////////////
+// The files of the I/O modules are cut in stripes distributed round-robin over
+// the nodes, and one process per node reads the stripes of the node, so that
+// the files are read once from the file system in total rather than once per
+// node. The prefetch is skipped if the share of the node, together with the 
+// memory profile of the program for all the processes of the node, does not 
+// fit in the memory budget (by default the physical memory of the node).
+bool Application::prefetchTrajectory(FilePrefetcher &prefetcher, const unsigned int traj)
+{
+    std::vector<std::string>           paths, files;
+    std::vector<FilePrefetcher::Range> ranges;
+    size_t                             fileSize, peakSize, budget;
+
+    if (GlobalSharedMemory::WorldShmRank != 0)
+    {
+        return false;
+    }
+    for (auto address: program_)
+    {
+        auto f = vm().getModule(address)->getInputFiles(traj);
+
+        paths.insert(paths.end(), f.begin(), f.end());
+    }
+    files    = FilePrefetcher::expand(paths);
+    ranges   = FilePrefetcher::share(files, GlobalSharedMemory::WorldNode,
+                                     GlobalSharedMemory::WorldNodes);
+    fileSize = FilePrefetcher::totalSize(ranges);
+    peakSize = vm().memoryNeeded(program_)*GlobalSharedMemory::WorldShmSize;
+    if (par_.prefetch.memoryBudgetMB > 0)
+    {
+        budget = static_cast<size_t>(par_.prefetch.memoryBudgetMB)*1024*1024;
+    }
+    else
+    {
+        budget = static_cast<size_t>(sysconf(_SC_PHYS_PAGES))*sysconf(_SC_PAGE_SIZE);
+    }
+    if (ranges.empty())
+    {
+        return false;
+    }
+    if (fileSize + peakSize > budget)
+    {
+        LOG(Warning) << "Skipping prefetch for trajectory " << traj << ": "
+                     << sizeString(fileSize) << " of files + " 
+                     << sizeString(peakSize) << " of program memory exceed budget "
+                     << sizeString(budget) << std::endl;
+
+        return false;
+    }
+    LOG(Message) << "Prefetching " << sizeString(fileSize) << " from " 
+                 << files.size() << " file(s) for trajectory " << traj 
+                 << " (share of node " << GlobalSharedMemory::WorldNode << "/"
+                 << GlobalSharedMemory::WorldNodes << ")" << std::endl;
+    prefetcher.start(ranges);
+
+    return true;
+}
+
 // loop on configurations //////////////////////////////////////////////////////
 void Application::configLoop(void)
 {
-    auto range = par_.trajCounter;
+    auto           range = par_.trajCounter;
+    FilePrefetcher prefetcher;
+    bool           prefetching;
+    double         waitTime;
     
     for (unsigned int t = range.start; t < range.end; t += range.step)
     {
         LOG(Message) << BIG_SEP << " Starting measurement for trajectory " << t
                      << " " << BIG_SEP << std::endl;
         vm().setTrajectory(t);
+        prefetching = par_.prefetch.enable and (t + range.step < range.end)
+                      and prefetchTrajectory(prefetcher, t + range.step);
         vm().executeProgram(program_);
+        if (prefetching)
+        {
+            size_t bytes;
+
+            waitTime = -usecond();
+            bytes    = prefetcher.wait();
+            waitTime += usecond();
+            LOG(Message) << "Prefetched " << sizeString(bytes) << " for trajectory "
+                         << t + range.step << " (waited " << waitTime/1.0e6 
+                         << " s)" << std::endl;
+        }
     }
     LOG(Message) << BIG_SEP << " End of measurement " << BIG_SEP << std::endl;
     env().freeAll();
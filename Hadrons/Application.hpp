@@ -32,6 +32,7 @@
 
 #include <Hadrons/Global.hpp>
 #include <Hadrons/Database.hpp>
+#include <Hadrons/FilePrefetcher.hpp>
 #include <Hadrons/Module.hpp>
 #include <Hadrons/VirtualMachine.hpp>
 
@@ -60,18 +61,28 @@ public:
                                         bool,         restoreModules,
                                         bool,         restoreMemoryProfile,
                                         bool,         restoreSchedule,
+                                        bool,         resume,
                                         std::string,  statDbBase,
                                         unsigned int, statDbPeriodMs);
         DatabasePar(void): 
         restoreModules{false}, restoreMemoryProfile{false},
-        restoreSchedule{false}, statDbBase{""} {}
+        restoreSchedule{false}, resume{false}, statDbBase{""} {}
     };
 
     struct SchedulerPar: Serializable
     {
         GRID_SERIALIZABLE_CLASS_MEMBERS(SchedulerPar,
-                                        std::string, schedulerType,);
-        SchedulerPar(void): schedulerType{"genetic"} {}
+                                        std::string,  schedulerType,
+                                        unsigned int, memoryBudgetMB);
+        SchedulerPar(void): schedulerType{"genetic"}, memoryBudgetMB{0} {}
+    };
+
+    struct PrefetchPar: Serializable
+    {
+        GRID_SERIALIZABLE_CLASS_MEMBERS(PrefetchPar,
+                                        bool,         enable,
+                                        unsigned int, memoryBudgetMB);
+        PrefetchPar(void): enable{false}, memoryBudgetMB{0} {}
     };
 
     struct GlobalPar: Serializable
@@ -81,6 +92,7 @@ public:
                                         DatabasePar,                database,
                                         VirtualMachine::GeneticPar, genetic,
                                         SchedulerPar,               scheduler,
+                                        PrefetchPar,                prefetch,
                                         std::string,                runId,
                                         std::string,                graphFile,
                                         std::string,                scheduleFile,
@@ -127,11 +139,13 @@ public:
     // schedule computation
     void schedule(void);
     void naiveSchedule(void);
+    void criticalPathSchedule(void);
     void saveSchedule(const std::string filename);
     void loadSchedule(const std::string filename);
     void printSchedule(void);
     // loop on configurations
     void configLoop(void);
+    bool prefetchTrajectory(FilePrefetcher &prefetcher, const unsigned int traj);
 private:
     // environment shortcut
     DEFINE_ENV_ALIAS;
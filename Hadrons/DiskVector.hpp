@@ -31,6 +31,8 @@
 #include <Hadrons/Global.hpp>
 #include <Hadrons/A2AMatrix.hpp>
 #include <deque>
+#include <list>
+#include <unordered_map>
 #include <sys/stat.h>
 #include <ftw.h>
 #include <unistd.h>
@@ -43,6 +45,13 @@
 
 BEGIN_HADRONS_NAMESPACE
 
+// cache eviction policies
+//   lru:    least recently used
+//   lfu:    least frequently used, ties resolved as LRU
+//   belady: element used furthest in the future according to the prefetch
+//           hints, LRU if no hints are available
+GRID_SERIALIZABLE_ENUM(DiskVectorPolicy, undef, lru, 0, lfu, 1, belady, 2);
+
 /******************************************************************************
  *                           Abstract base class                              *
  ******************************************************************************/
@@ -93,35 +102,77 @@ public:
     virtual ~DiskVectorBase(void);
     const T & operator[](const unsigned int i) const;
     RwAccessHelper operator[](const unsigned int i);
+    // access pattern hint: the elements of seq are expected to be accessed 
+    // in this order, up to depth of them are loaded ahead on background
+    // threads (the hint sequence must be identical on all ranks)
+    void prefetch(const std::vector<unsigned int> &seq, 
+                  const unsigned int depth = 1) const;
+    void clearPrefetch(void) const;
+    // statistics
     double hitRatio(void) const;
+    double prefetchHitRatio(void) const;
+    double missRatio(void) const;
+    double stallTime(void) const;
+    double loadTime(void) const;
     void resetStat(void);
+    // cache eviction policy
+    void setPolicy(const DiskVectorPolicy policy);
+    DiskVectorPolicy getPolicy(void) const;
     void setSize(unsigned int size_);
     unsigned int getSize() const;
     unsigned int dvSize;
     void setGrid(GridBase *grid_);
     GridBase *getGrid() const;
     GridBase *dvGrid;
+private:
+    struct PrefetchState
+    {
+        std::deque<unsigned int>                   hint;
+        std::map<unsigned int, std::unique_ptr<T>> obj;
+        std::map<unsigned int, std::future<void>>  ready;
+        unsigned int                               depth{0};
+    };
 private:
     virtual void load(T &obj, const std::string filename) const = 0;
     virtual void save(const std::string filename, const T &obj) const = 0;
+    // split load for prefetching: loadLocal is executed on a background
+    // thread and must not communicate, distribute is then called by all 
+    // ranks when the element is accessed
+    virtual void loadLocal(T &obj, const std::string filename) const;
+    virtual void distribute(T &obj) const;
     virtual std::string filename(const unsigned int i) const;
+    unsigned int cacheSlot(const unsigned int i) const;
+    void touch(const unsigned int slot) const;
+    unsigned int victim(void) const;
     void evict(void) const;
     void fetch(const unsigned int i) const;
+    bool fetchPrefetched(const unsigned int i) const;
+    void advancePrefetch(const unsigned int i) const;
+    void dropPrefetched(const unsigned int i) const;
     void cacheInsert(const unsigned int i, const T &obj) const;
     void clean(void);
 private:
     std::string                                           dirname_;
     unsigned int                                          size_, cacheSize_;
     double                                                access_{0.}, hit_{0.};
+    double                                                prefetchHit_{0.}, miss_{0.};
+    double                                                stall_{0.}, loadTime_{0.};
     bool                                                  clean_;
     GridBase                                              *grid_;
+    DiskVectorPolicy                                      policy_{DiskVectorPolicy::lru};
     // using pointers to allow modifications when class is const
     // semantic: const means data unmodified, but cache modification allowed
-    std::unique_ptr<std::vector<T>>                       cachePtr_;
-    std::unique_ptr<std::vector<bool>>                    modifiedPtr_;
-    std::unique_ptr<std::map<unsigned int, unsigned int>> indexPtr_;
-    std::unique_ptr<std::stack<unsigned int>>             freePtr_;
-    std::unique_ptr<std::deque<unsigned int>>             loadsPtr_;                
+    // cache, modified flags, LRU positions and access counts are indexed
+    // by cache slot, index maps a vector element to its slot, and loads 
+    // holds the cached elements from least to most recently used
+    std::unique_ptr<std::vector<T>>                                 cachePtr_;
+    std::unique_ptr<std::vector<bool>>                              modifiedPtr_;
+    std::unique_ptr<std::unordered_map<unsigned int, unsigned int>> indexPtr_;
+    std::unique_ptr<std::stack<unsigned int>>                       freePtr_;
+    std::unique_ptr<std::list<unsigned int>>                        loadsPtr_;
+    std::unique_ptr<std::vector<std::list<unsigned int>::iterator>> loadsPosPtr_;
+    std::unique_ptr<std::vector<unsigned long>>                     freqPtr_;
+    std::unique_ptr<PrefetchState>                                  prefetchPtr_;
 };
 
 /******************************************************************************
@@ -176,6 +227,13 @@ public:
     }
 private:
     virtual void load(EigenDiskVectorMat<T> &obj, const std::string filename) const
+    {
+        loadLocal(obj, filename);
+        distribute(obj);
+    }
+
+    // boss read and checksum, no communication
+    virtual void loadLocal(EigenDiskVectorMat<T> &obj, const std::string filename) const
     {
         GridBase *loadGrid;
         loadGrid = (*this).getGrid();
@@ -210,10 +268,21 @@ private:
                 HADRONS_ERROR(Io, "checksum failed")
             }
         }
-        int broadcastSize;
-        broadcastSize = sizeof(T)*obj.size();
+    }
+
+    virtual void distribute(EigenDiskVectorMat<T> &obj) const
+    {
+        GridBase *loadGrid;
+        loadGrid = (*this).getGrid();
         if (loadGrid)
         {
+            Eigen::Index nRow = obj.rows(), nCol = obj.cols();
+            int          broadcastSize;
+
+            loadGrid->Broadcast(loadGrid->BossRank(), &nRow, sizeof(nRow));
+            loadGrid->Broadcast(loadGrid->BossRank(), &nCol, sizeof(nCol));
+            obj.resize(nRow, nCol);
+            broadcastSize = sizeof(T)*obj.size();
             loadGrid->Broadcast(loadGrid->BossRank(), obj.data(), broadcastSize);
             loadGrid->Barrier();
         }
@@ -265,11 +334,14 @@ DiskVectorBase<T>::DiskVectorBase(const std::string dirname,
                                   const bool clean,
                                   GridBase *grid)
 : dirname_(dirname), size_(size), cacheSize_(cacheSize), clean_(clean), grid_(grid)
-, cachePtr_(new std::vector<T>(size))
-, modifiedPtr_(new std::vector<bool>(size, false))
-, indexPtr_(new std::map<unsigned int, unsigned int>())
+, cachePtr_(new std::vector<T>(cacheSize))
+, modifiedPtr_(new std::vector<bool>(cacheSize, false))
+, indexPtr_(new std::unordered_map<unsigned int, unsigned int>())
 , freePtr_(new std::stack<unsigned int>)
-, loadsPtr_(new std::deque<unsigned int>())
+, loadsPtr_(new std::list<unsigned int>())
+, loadsPosPtr_(new std::vector<std::list<unsigned int>::iterator>(cacheSize))
+, freqPtr_(new std::vector<unsigned long>(cacheSize, 0))
+, prefetchPtr_(new PrefetchState)
 {
     struct stat s;
 
@@ -293,6 +365,11 @@ DiskVectorBase<T>::DiskVectorBase(const std::string dirname,
 template <typename T>
 DiskVectorBase<T>::~DiskVectorBase(void)
 {
+    // moved-from vectors have no state left
+    if (prefetchPtr_)
+    {
+        clearPrefetch();
+    }
     if (clean_)
     {
         clean();
@@ -340,19 +417,26 @@ const T & DiskVectorBase<T>::operator[](const unsigned int i) const
     const_cast<double &>(access_)++;
     if (index.find(i) == index.end())
     {
-        // cache miss
-        DV_DEBUG_MSG(this, "cache miss");
-        fetch(i);
+        if (fetchPrefetched(i))
+        {
+            DV_DEBUG_MSG(this, "cache miss, prefetched");
+            const_cast<double &>(prefetchHit_)++;
+        }
+        else
+        {
+            // cache miss
+            DV_DEBUG_MSG(this, "cache miss");
+            const_cast<double &>(miss_)++;
+            const_cast<double &>(loadTime_) -= usecond();
+            fetch(i);
+            const_cast<double &>(loadTime_) += usecond();
+        }
     }
     else
     {
         DV_DEBUG_MSG(this, "cache hit");
-
-        auto pos = std::find(loads.begin(), loads.end(), i);
-
         const_cast<double &>(hit_)++;
-        loads.erase(pos);
-        loads.push_back(i);
+        touch(index.at(i));
     }
 
 #ifdef DV_DEBUG
@@ -364,7 +448,8 @@ const T & DiskVectorBase<T>::operator[](const unsigned int i) const
     }
     DV_DEBUG_MSG(this, "in cache: " << msg);
 #endif
-    if (grid_)  grid_->Barrier();
+    advancePrefetch(i);
+
     return cache[index.at(i)];
 }
 
@@ -387,11 +472,91 @@ double DiskVectorBase<T>::hitRatio(void) const
     return hit_/access_;
 }
 
+template <typename T>
+double DiskVectorBase<T>::prefetchHitRatio(void) const
+{
+    return prefetchHit_/access_;
+}
+
+template <typename T>
+double DiskVectorBase<T>::missRatio(void) const
+{
+    return miss_/access_;
+}
+
+template <typename T>
+double DiskVectorBase<T>::stallTime(void) const
+{
+    return stall_;
+}
+
+template <typename T>
+double DiskVectorBase<T>::loadTime(void) const
+{
+    return loadTime_;
+}
+
 template <typename T>
 void DiskVectorBase<T>::resetStat(void)
 {
-    access_ = 0.;
-    hit_    = 0.;
+    access_      = 0.;
+    hit_         = 0.;
+    prefetchHit_ = 0.;
+    miss_        = 0.;
+    stall_       = 0.;
+    loadTime_    = 0.;
+}
+
+template <typename T>
+void DiskVectorBase<T>::prefetch(const std::vector<unsigned int> &seq,
+                                 const unsigned int depth) const
+{
+    auto &pf = *prefetchPtr_;
+
+    for (auto i: seq)
+    {
+        if (i >= size_)
+        {
+            HADRONS_ERROR(Size, "prefetch index out of range");
+        }
+        pf.hint.push_back(i);
+    }
+    pf.depth = depth;
+    advancePrefetch(size_);
+}
+
+template <typename T>
+void DiskVectorBase<T>::clearPrefetch(void) const
+{
+    auto &pf = *prefetchPtr_;
+
+    pf.hint.clear();
+    while (!pf.obj.empty())
+    {
+        dropPrefetched(pf.obj.begin()->first);
+    }
+}
+
+template <typename T>
+void DiskVectorBase<T>::loadLocal(T &obj, const std::string filename) const
+{
+    load(obj, filename);
+}
+
+template <typename T>
+void DiskVectorBase<T>::distribute(T &obj) const
+{}
+
+template <typename T>
+void DiskVectorBase<T>::setPolicy(const DiskVectorPolicy policy)
+{
+    policy_ = policy;
+}
+
+template <typename T>
+DiskVectorPolicy DiskVectorBase<T>::getPolicy(void) const
+{
+    return policy_;
 }
 
 template <typename T>
@@ -400,6 +565,106 @@ std::string DiskVectorBase<T>::filename(const unsigned int i) const
     return dirname_ + "/elem_" + std::to_string(i);
 }
 
+// allocate a free slot to element i, as the most recently used
+template <typename T>
+unsigned int DiskVectorBase<T>::cacheSlot(const unsigned int i) const
+{
+    auto         &modified = *modifiedPtr_;
+    auto         &index    = *indexPtr_;
+    auto         &freeInd  = *freePtr_;
+    auto         &loads    = *loadsPtr_;
+    auto         &loadsPos = *loadsPosPtr_;
+    auto         &freq     = *freqPtr_;
+    unsigned int slot      = freeInd.top();
+
+    freeInd.pop();
+    index[i]       = slot;
+    loadsPos[slot] = loads.insert(loads.end(), i);
+    freq[slot]     = 1;
+    modified[slot] = false;
+
+    return slot;
+}
+
+// O(1) hit bookkeeping
+template <typename T>
+void DiskVectorBase<T>::touch(const unsigned int slot) const
+{
+    auto &loads    = *loadsPtr_;
+    auto &loadsPos = *loadsPosPtr_;
+    auto &freq     = *freqPtr_;
+
+    loads.splice(loads.end(), loads, loadsPos[slot]);
+    freq[slot]++;
+}
+
+// element to evict according to the policy, only called on a full cache
+template <typename T>
+unsigned int DiskVectorBase<T>::victim(void) const
+{
+    auto &index = *indexPtr_;
+    auto &loads = *loadsPtr_;
+    auto &freq  = *freqPtr_;
+    auto &pf    = *prefetchPtr_;
+
+    if (policy_ == DiskVectorPolicy::lfu)
+    {
+        unsigned int  v     = loads.front();
+        unsigned long vFreq = freq[index.at(v)];
+
+        // traversal in LRU order resolves ties
+        for (auto i: loads)
+        {
+            if (freq[index.at(i)] < vFreq)
+            {
+                v     = i;
+                vFreq = freq[index.at(i)];
+            }
+        }
+
+        return v;
+    }
+    else if ((policy_ == DiskVectorPolicy::belady) and !pf.hint.empty())
+    {
+        std::unordered_map<unsigned int, size_t> next;
+        size_t window = std::min(pf.hint.size(), 
+                                 static_cast<size_t>(size_)*cacheSize_);
+
+        // first upcoming use of each cached element
+        for (size_t k = 0; (k < window) and (next.size() < index.size()); ++k)
+        {
+            unsigned int i = pf.hint[k];
+
+            if ((index.find(i) != index.end()) and (next.find(i) == next.end()))
+            {
+                next[i] = k;
+            }
+        }
+        // evict the element never used again or used last, LRU for ties
+        unsigned int v     = loads.front();
+        size_t       vNext = 0;
+
+        for (auto i: loads)
+        {
+            if (next.find(i) == next.end())
+            {
+                return i;
+            }
+            else if (next.at(i) > vNext)
+            {
+                v     = i;
+                vNext = next.at(i);
+            }
+        }
+
+        return v;
+    }
+    else
+    {
+        return loads.front();
+    }
+}
+
 template <typename T>
 void DiskVectorBase<T>::evict(void) const
 {
@@ -408,20 +673,22 @@ void DiskVectorBase<T>::evict(void) const
     auto &index    = *indexPtr_;
     auto &freeInd  = *freePtr_;
     auto &loads    = *loadsPtr_;
+    auto &loadsPos = *loadsPosPtr_;
 
     if (index.size() >= cacheSize_)
     {
-        unsigned int i = loads.front();
+        unsigned int i    = victim();
+        unsigned int slot = index.at(i);
         
         DV_DEBUG_MSG(this, "evicting " << i);
-        if (modified[index.at(i)])
+        if (modified[slot])
         {
             DV_DEBUG_MSG(this, "element " << i << " modified, saving to disk");
-            save(filename(i), cache[index.at(i)]);
+            save(filename(i), cache[slot]);
         }
-        freeInd.push(index.at(i));
+        freeInd.push(slot);
         index.erase(i);
-        loads.pop_front();
+        loads.erase(loadsPos[slot]);
     }
     if (grid_)  grid_->Barrier();
 }
@@ -445,34 +712,127 @@ void DiskVectorBase<T>::fetch(const unsigned int i) const
     {
         HADRONS_ERROR(Io, "disk vector element " + std::to_string(i) + " uninitialised");
     }
-    index[i] = freeInd.top();
-    freeInd.pop();
-    load(cache[index.at(i)], filename(i));
-    loads.push_back(i);
-    modified[index.at(i)] = false;
+    load(cache[cacheSlot(i)], filename(i));
 }
 
 template <typename T>
-void DiskVectorBase<T>::cacheInsert(const unsigned int i, const T &obj) const
+bool DiskVectorBase<T>::fetchPrefetched(const unsigned int i) const
 {
     auto &cache    = *cachePtr_;
     auto &modified = *modifiedPtr_;
     auto &index    = *indexPtr_;
     auto &freeInd  = *freePtr_;
     auto &loads    = *loadsPtr_;
+    auto &pf       = *prefetchPtr_;
 
+    if (pf.obj.find(i) == pf.obj.end())
+    {
+        return false;
+    }
+    // only the remaining background read time is a stall
+    const_cast<double &>(stall_) -= usecond();
+    pf.ready.at(i).get();
+    const_cast<double &>(stall_) += usecond();
+    distribute(*pf.obj.at(i));
     evict();
-    if (index.find(i) == index.end()) {
-	index[i] = freeInd.top();
-	freeInd.pop();
+    cache[cacheSlot(i)] = std::move(*pf.obj.at(i));
+    pf.obj.erase(i);
+    pf.ready.erase(i);
+
+    return true;
+}
+
+template <typename T>
+void DiskVectorBase<T>::advancePrefetch(const unsigned int i) const
+{
+    auto         &index = *indexPtr_;
+    auto         &pf    = *prefetchPtr_;
+    unsigned int window = pf.depth + cacheSize_;
+    struct stat  s;
+
+    if (pf.hint.empty())
+    {
+        return;
+    }
+    // consume the hint sequence up to the current access
+    auto end = pf.hint.begin() + std::min(static_cast<size_t>(window), pf.hint.size());
+    auto pos = std::find(pf.hint.begin(), end, i);
+
+    if (pos != end)
+    {
+        pf.hint.erase(pf.hint.begin(), pos + 1);
+        end = pf.hint.begin() + std::min(static_cast<size_t>(window), pf.hint.size());
+    }
+    // drop prefetched elements which are not expected soon anymore
+    std::vector<unsigned int> stale;
+
+    for (auto &o: pf.obj)
+    {
+        if (std::find(pf.hint.begin(), end, o.first) == end)
+        {
+            stale.push_back(o.first);
+        }
+    }
+    for (auto j: stale)
+    {
+        dropPrefetched(j);
     }
-    else {
-	auto pos = std::find(loads.begin(), loads.end(), i);
-	assert(pos != loads.end());
-	loads.erase(pos);
+    // start background loads
+    for (auto it = pf.hint.begin(); (it != end) and (pf.obj.size() < pf.depth); ++it)
+    {
+        unsigned int j = *it;
+
+        if ((index.find(j) == index.end()) and (pf.obj.find(j) == pf.obj.end())
+            and (stat(filename(j).c_str(), &s) == 0))
+        {
+            T           *pt = new T;
+            std::string f   = filename(j);
+
+            DV_DEBUG_MSG(this, "prefetching " << j);
+            pf.obj[j].reset(pt);
+            pf.ready[j] = std::async(std::launch::async, [this, pt, f](void)
+            {
+                loadLocal(*pt, f);
+            });
+        }
+    }
+}
+
+template <typename T>
+void DiskVectorBase<T>::dropPrefetched(const unsigned int i) const
+{
+    auto &pf = *prefetchPtr_;
+
+    if (pf.obj.find(i) != pf.obj.end())
+    {
+        DV_DEBUG_MSG(this, "dropping prefetched " << i);
+        pf.ready.at(i).wait();
+        pf.ready.erase(i);
+        pf.obj.erase(i);
+    }
+}
+
+template <typename T>
+void DiskVectorBase<T>::cacheInsert(const unsigned int i, const T &obj) const
+{
+    auto &cache    = *cachePtr_;
+    auto &modified = *modifiedPtr_;
+    auto &index    = *indexPtr_;
+    auto &freeInd  = *freePtr_;
+    auto &loads    = *loadsPtr_;
+
+    // a prefetched copy would be stale
+    dropPrefetched(i);
+    if (index.find(i) == index.end())
+    {
+        evict();
+        cacheSlot(i);
+    }
+    else
+    {
+        touch(index.at(i));
     }
     cache[index.at(i)] = obj;
-    loads.push_back(i);
     modified[index.at(i)] = false;
 
     if (grid_)  grid_->Barrier();
@@ -154,9 +154,28 @@ public:
     void load(Vec<VecT> &v, const uint t, const std::string dataset_name, double *tRead = nullptr, GridBase *grid = nullptr);
     template <typename Mat>
     void load(Mat &v, const uint t, const std::string dataset_name, double *tRead = nullptr, GridBase *grid = nullptr);
+    // I/O session: while open, the file, groups and datasets are kept open
+    // between block writes, the file is flushed once on closing.
+    // Copies of this object share the same session.
+    void openSession(void);
+    void closeSession(void);
+    bool hasSession(void) const;
+private:
+#ifdef HAVE_HDF5
+    struct Session
+    {
+        H5NS::H5File                         file;
+        H5NS::Group                          root;
+        std::map<std::string, H5NS::Group>   tgroup;
+        std::map<std::string, H5NS::DataSet> dataset;
+    };
+#endif
 private:
     std::string  filename_{""}, dataname_{""};
     uint nt_{0}, ni_{0}, nj_{0};
+#ifdef HAVE_HDF5
+    std::shared_ptr<Session> session_{nullptr};
+#endif
 };
 
 // implementation /////////////////////////////////////////////////////////////////
@@ -197,11 +216,24 @@ void DistilMatrixIo<T>::saveBlock(const T *data,
                                const uint chunkSize)
 {
 #ifdef HAVE_HDF5
-    H5NS::H5File file(filename_,H5F_ACC_RDWR);
-    H5NS::Group rootgroup = file.openGroup(DISTIL_MATRIX_NAME);
+    H5NS::H5File file;
+    H5NS::Group  rootgroup, tgroup;
+    std::string  dsetKey = t_name + "/" + datasetName;
 
-    H5NS::Group tgroup;
-    if ( H5Lexists( rootgroup.getId(), t_name.c_str(), H5P_DEFAULT ) > 0 )
+    if (session_)
+    {
+        rootgroup = session_->root;
+    }
+    else
+    {
+        file      = H5NS::H5File(filename_, H5F_ACC_RDWR);
+        rootgroup = file.openGroup(DISTIL_MATRIX_NAME);
+    }
+    if (session_ and (session_->tgroup.count(t_name) > 0))
+    {
+        tgroup = session_->tgroup.at(t_name);
+    }
+    else if ( H5Lexists( rootgroup.getId(), t_name.c_str(), H5P_DEFAULT ) > 0 )
     {
         tgroup = rootgroup.openGroup(t_name);
     }
@@ -209,9 +241,17 @@ void DistilMatrixIo<T>::saveBlock(const T *data,
     {
         tgroup = rootgroup.createGroup(t_name);
     }
+    if (session_)
+    {
+        session_->tgroup[t_name] = tgroup;
+    }
 
     H5NS::DataSet        dataset;
-    if ( H5Lexists( tgroup.getId(), datasetName.c_str(), H5P_DEFAULT ) > 0 )
+    if (session_ and (session_->dataset.count(dsetKey) > 0))
+    {
+        dataset = session_->dataset.at(dsetKey);
+    }
+    else if ( H5Lexists( tgroup.getId(), datasetName.c_str(), H5P_DEFAULT ) > 0 )
     {
         dataset = tgroup.openDataSet(datasetName);
     }
@@ -228,6 +268,10 @@ void DistilMatrixIo<T>::saveBlock(const T *data,
         plist.setFletcher32();
         dataset = tgroup.createDataSet(datasetName, Hdf5Type<T>::type(), dataspace, plist);
     }
+    if (session_)
+    {
+        session_->dataset[dsetKey] = dataset;
+    }
 
     std::vector<hsize_t> count = {blockSizei, blockSizej},
                          offset = {static_cast<hsize_t>(i),
@@ -245,6 +289,45 @@ void DistilMatrixIo<T>::saveBlock(const T *data,
 #endif
 }
 
+// I/O session /////////////////////////////////////////////////////////////////
+template <typename T>
+void DistilMatrixIo<T>::openSession(void)
+{
+#ifdef HAVE_HDF5
+    if (!session_)
+    {
+        session_       = std::make_shared<Session>();
+        session_->file = H5NS::H5File(filename_, H5F_ACC_RDWR);
+        session_->root = session_->file.openGroup(DISTIL_MATRIX_NAME);
+    }
+#else
+    HADRONS_ERROR(Implementation, "distil matrix I/O needs HDF5 library");
+#endif
+}
+
+template <typename T>
+void DistilMatrixIo<T>::closeSession(void)
+{
+#ifdef HAVE_HDF5
+    if (session_)
+    {
+        session_->file.flush(H5F_SCOPE_GLOBAL);
+        // the file is closed when the last copy sharing the session resets
+        session_.reset();
+    }
+#endif
+}
+
+template <typename T>
+bool DistilMatrixIo<T>::hasSession(void) const
+{
+#ifdef HAVE_HDF5
+    return (session_ != nullptr);
+#else
+    return false;
+#endif
+}
+
 template <typename T>
 void DistilMatrixIo<T>::saveBlock(const DistilMatrixSetTimeSliceIo<T> &m,
                             //    const uint ext, const uint str,
@@ -494,6 +577,7 @@ private:
                             Side                                    s,
                             std::vector<uint>                       dt_list,
                             std::map<Side, MDistil::PerambTensor&>  peramb);
+    bool isSavedTimeSlice(Side s, uint dt, uint t);
     std::vector<uint> fetchDvBatchIdxs(uint                  ibatch,
                                         std::vector<uint>    time_dil_sources,
                                         uint                 shift=0);
@@ -605,6 +689,23 @@ bool DmfComputation<FImpl,T,Tio>::isRho(Side s)
     return (dmfType_.at(s)=="rho" ? true : false);
 }
 
+// rho meson fields are only saved on the time slices of their time-dilution
+// partition dt
+template <typename FImpl, typename T, typename Tio>
+bool DmfComputation<FImpl,T,Tio>::isSavedTimeSlice(Side s, uint dt, uint t)
+{
+    if (isRho(s))
+    {
+        std::vector<uint> partition = distilNoise_.at(s).dilutionPartition(Index::t, dt);
+
+        return (std::count(partition.begin(), partition.end(), t) > 0);
+    }
+    else
+    {
+        return true;
+    }
+}
+
 // fetch time dilution indices (sources) in dv batch ibatch
 template <typename FImpl, typename T, typename Tio>
 std::vector<uint> DmfComputation<FImpl,T,Tio>
@@ -902,9 +1003,29 @@ void DmfComputation<FImpl,T,Tio>
     const uint nExtStr = nExt_*nStr_;
     const uint nExtStrLocal = g_->IsBoss() ? nExtStr/N_ranks 
                                         + nExtStr%N_ranks : nExtStr/N_ranks; // put remainder in boss node
+    // files written by this rank, each one kept open until its last block
+    std::map<std::string, DistilMatrixIo<HADRONS_DISTIL_IO_TYPE>> ioSession;
+    uint ioStep = 0, nIoStep = 0;
 
     Side anchored_side = (Side::right==relative_side ? Side::left : Side::right);
 
+    // every IO step writes a block to all the files of this rank, the last
+    // one writes the last block of each file
+    for(auto delta_t : delta_t_list)
+    for (uint ibatchAnchored=0 ; ibatchAnchored<time_dil_source.at(anchored_side).size()/dvBatchSize_ ; ibatchAnchored++)
+    for (auto Tanchored : fetchDvBatchIdxs(ibatchAnchored,time_dil_source.at(anchored_side)))
+    for (auto Trelative : time_dil_source.at(relative_side))
+    {
+        uint t = (Trelative + delta_t)%nt_;
+
+        if (isSavedTimeSlice(relative_side, Trelative, t) and isSavedTimeSlice(anchored_side, Tanchored, t))
+        {
+            nIoStep++;
+        }
+    }
+    nIoStep *= (dilSizeLS_.at(relative_side)/blockSize_ + (((dilSizeLS_.at(relative_side) % blockSize_) != 0) ? 1 : 0))
+              *(dilSizeLS_.at(anchored_side)/blockSize_ + (((dilSizeLS_.at(anchored_side) % blockSize_) != 0) ? 1 : 0));
+
     for(auto delta_t : delta_t_list)
     {        
         START_TIMER("distil vectors");
@@ -1034,13 +1155,10 @@ void DmfComputation<FImpl,T,Tio>
                         std::string dataset_name = std::to_string( (Side::right==relative_side) ? Tanchored : Trelative ) 
                             + "-" + std::to_string( (Side::right==relative_side) ? Trelative : Tanchored );
 
-                        std::vector<uint> relative_partition = distilNoise_.at(relative_side).dilutionPartition(Index::t,Trelative);
-                        std::vector<uint> anchored_partition = distilNoise_.at(anchored_side).dilutionPartition(Index::t,Tanchored);
-
-                        if( !( isRho(relative_side) and std::count(relative_partition.begin(), relative_partition.end(), t)==0  ) 
-                            and !(isRho(anchored_side) and std::count(anchored_partition.begin(), anchored_partition.end(), t)==0) )
+                        if( isSavedTimeSlice(relative_side, Trelative, t) and isSavedTimeSlice(anchored_side, Tanchored, t) )
                         {
                             LOG(Message)    << "Saving block " << dataset_name << " , t=" << t << std::endl;
+                            ioStep++;
 
                             double ioTime = -GET_TIMER("IO: write block");
                             START_TIMER("IO: total");
@@ -1052,9 +1170,14 @@ void DmfComputation<FImpl,T,Tio>
                                 const uint iext = iextstr/nStr_;
                                 const uint istr = iextstr%nStr_;
 
-                                // io object
-                                DistilMatrixIo<HADRONS_DISTIL_IO_TYPE> matrix_io(filenameDmfFn(iext, istr, n_idx.at(Side::left), n_idx.at(Side::right)),
-                                        DISTIL_MATRIX_NAME, nt_, dilSizeLS_.at(Side::left), dilSizeLS_.at(Side::right));
+                                // io object, the session is shared by all the blocks of a file
+                                std::string filename = filenameDmfFn(iext, istr, n_idx.at(Side::left), n_idx.at(Side::right));
+                                if (ioSession.find(filename) == ioSession.end())
+                                {
+                                    ioSession.emplace(filename, DistilMatrixIo<HADRONS_DISTIL_IO_TYPE>(filename,
+                                        DISTIL_MATRIX_NAME, nt_, dilSizeLS_.at(Side::left), dilSizeLS_.at(Side::right)));
+                                }
+                                auto &matrix_io = ioSession.at(filename);
 
                                 //executes once per file
                                 if( ( Tanchored==time_dil_source.at(anchored_side).front() ) and      //first time-dilution idx at one side
@@ -1067,6 +1190,7 @@ void DmfComputation<FImpl,T,Tio>
                                                             fetchDilutionMap(Side::left),fetchDilutionMap(Side::right));
                                     //init file and write metadata
                                     START_TIMER("IO: file creation");
+                                    matrix_io.closeSession();
                                     matrix_io.initFile(md);
                                     STOP_TIMER("IO: file creation");
                                 }
@@ -1074,7 +1198,16 @@ void DmfComputation<FImpl,T,Tio>
                                 uint left_i  = (Side::left==relative_side)  ? iRel : jAnchor;
                                 uint right_j  = (Side::right==relative_side)  ? iRel : jAnchor;
                                 START_TIMER("IO: write block");
+                                if (!matrix_io.hasSession())
+                                {
+                                    matrix_io.openSession();
+                                }
                                 matrix_io.saveBlock(block_relative, iextstr_local, left_i, right_j, dataset_name, t, blockSize_);
+                                if (ioStep == nIoStep)
+                                {
+                                    matrix_io.closeSession();
+                                    ioSession.erase(filename);
+                                }
                                 STOP_TIMER("IO: write block");
                             }
                             g_->Barrier();
@@ -1122,6 +1255,30 @@ void DmfComputation<FImpl,T,Tio>
     const uint nExtStr = nExt_*nStr_;
     const uint nExtStrLocal = g_->IsBoss() ? nExtStr/N_ranks 
                                         + nExtStr%N_ranks : nExtStr/N_ranks; // put remainder in boss node
+    // files written by this rank, each one kept open until its last block
+    std::map<std::string, DistilMatrixIo<HADRONS_DISTIL_IO_TYPE>> ioSession;
+    uint ioStep = 0, nIoStep = 0;
+
+    // every IO step writes a block to all the files of this rank, the last
+    // one writes the last block of each file
+    for (uint ibatchL=0 ; ibatchL<time_dil_source.at(Side::left).size()/dvBatchSize_ ; ibatchL++)
+    for (auto dtL : fetchDvBatchIdxs(ibatchL,time_dil_source.at(Side::left)))
+    for (uint ibatchR=0 ; ibatchR<time_dil_source.at(Side::right).size()/dvBatchSize_ ; ibatchR++)
+    for (auto dtR : fetchDvBatchIdxs(ibatchR,time_dil_source.at(Side::right), diag_shift))
+    {
+        if( !only_diag or ((dtL+diag_shift)%distilNoise_.at(Side::right).dilutionSize(Index::t)==dtR) )
+        {
+            for(uint t=0 ; t<nt_ ; t++)
+            {
+                if (isSavedTimeSlice(Side::left, dtL, t) and isSavedTimeSlice(Side::right, dtR, t))
+                {
+                    nIoStep++;
+                }
+            }
+        }
+    }
+    nIoStep *= (dilSizeLS_.at(Side::left)/blockSize_ + (((dilSizeLS_.at(Side::left) % blockSize_) != 0) ? 1 : 0))
+              *(dilSizeLS_.at(Side::right)/blockSize_ + (((dilSizeLS_.at(Side::right) % blockSize_) != 0) ? 1 : 0));
 
     //loop over left dv batches
     for (uint ibatchL=0 ; ibatchL<time_dil_source.at(Side::left).size()/dvBatchSize_ ; ibatchL++)   //loop over left dv batches
@@ -1251,16 +1408,13 @@ void DmfComputation<FImpl,T,Tio>
                             {
                                 // TODO: generalise to dilution
                                 // uint t = ts_intersection[it];
-                                std::vector<uint> left_partition = distilNoise_.at(Side::left).dilutionPartition(Index::t,dtL);
-                                std::vector<uint> right_partition = distilNoise_.at(Side::right).dilutionPartition(Index::t,dtR);
-
-                                if( !( isRho(Side::left) and std::count(left_partition.begin(), left_partition.end(), t)==0  ) 
-                                    and !(isRho(Side::right) and std::count(right_partition.begin(), right_partition.end(), t)==0) )
+                                if( isSavedTimeSlice(Side::left, dtL, t) and isSavedTimeSlice(Side::right, dtR, t) )
                                 {
                                     // use same buffer but map it differently 
                                     DistilMatrixSetTimeSliceIo<Tio> block_relative(bBuf.data(), nExtStrLocal , iblock_size, jblock_size); 
                                     std::string dataset_name = std::to_string(dtL)+"-"+std::to_string(dtR);
                                     LOG(Message)    << "Saving block block " << dataset_name << " , t=" << t << std::endl;
+                                    ioStep++;
 
                                     double ioTime = -GET_TIMER("IO: write block");
                                     START_TIMER("IO: total");
@@ -1272,9 +1426,14 @@ void DmfComputation<FImpl,T,Tio>
                                         const uint iext = iextstr/nStr_;
                                         const uint istr = iextstr%nStr_;
 
-                                        // io object
-                                        DistilMatrixIo<HADRONS_DISTIL_IO_TYPE> matrix_io(filenameDmfFn(iext, istr, n_idx.at(Side::left), n_idx.at(Side::right)),
-                                                DISTIL_MATRIX_NAME, nt_, dilSizeLS_.at(Side::left), dilSizeLS_.at(Side::right));
+                                        // io object, the session is shared by all the blocks of a file
+                                        std::string filename = filenameDmfFn(iext, istr, n_idx.at(Side::left), n_idx.at(Side::right));
+                                        if (ioSession.find(filename) == ioSession.end())
+                                        {
+                                            ioSession.emplace(filename, DistilMatrixIo<HADRONS_DISTIL_IO_TYPE>(filename,
+                                                DISTIL_MATRIX_NAME, nt_, dilSizeLS_.at(Side::left), dilSizeLS_.at(Side::right)));
+                                        }
+                                        auto &matrix_io = ioSession.at(filename);
 
                                         //executes once per file
                                         if( ( dtL==time_dil_source.at(Side::left).front() ) and      //first time-dilution idx at one side
@@ -1287,11 +1446,21 @@ void DmfComputation<FImpl,T,Tio>
                                                                     fetchDilutionMap(Side::left),fetchDilutionMap(Side::right));
                                             //init file and write metadata
                                             START_TIMER("IO: file creation");
+                                            matrix_io.closeSession();
                                             matrix_io.initFile(md);
                                             STOP_TIMER("IO: file creation");
                                         }
                                         START_TIMER("IO: write block");
+                                        if (!matrix_io.hasSession())
+                                        {
+                                            matrix_io.openSession();
+                                        }
                                         matrix_io.saveBlock(block_relative, iextstr_local, i, j, dataset_name, t, blockSize_);
+                                        if (ioStep == nIoStep)
+                                        {
+                                            matrix_io.closeSession();
+                                            ioSession.erase(filename);
+                                        }
                                         STOP_TIMER("IO: write block");
                                     }
                                     g_->Barrier();
@@ -50,8 +50,8 @@ public:
     typedef Lattice<vSiteScalar>                  ScalarField;
     typedef std::function<void(GaugeField &)>     TransformFn;
 public:
-    // constructor
-    TEmFieldGenerator(GridBase *g);
+    // constructor (a shared FFT object can be provided, see Environment::getFft)
+    TEmFieldGenerator(GridBase *g, FFT *fft = nullptr);
     // static functions to construct useful lattices
     static void makeSpatialNorm(LatticeInteger &out);
     static void makeKHat(std::vector<ScalarField> &out);
@@ -63,6 +63,14 @@ public:
     // field generation using given weights
     void operator()(GaugeField &out, GridParallelRNG &rng, const ScalarField &weight, 
                     TransformFn momSpaceTransform = nullptr);
+    // sqrt(vol*weight), to be cached next to the weights
+    static void makeSqrtWeight(ScalarField &sqrtWeight, const ScalarField &weight);
+    // field generation using a given sqrt(vol*weight)
+    void generate(GaugeField &out, GridParallelRNG &rng, const ScalarField &sqrtWeight,
+                  TransformFn momSpaceTransform = nullptr);
+    // batched field generation, the work fields are reused for all the fields
+    void generate(std::vector<GaugeField> &out, GridParallelRNG &rng, 
+                  const ScalarField &sqrtWeight, TransformFn momSpaceTransform = nullptr);
     // QED_L weights
     void makeWeightsQedL(ScalarField &weight, std::vector<double> improvement = {});
     // QED_TL weights
@@ -72,12 +80,15 @@ public:
     // QED_M weights
     void makeWeightsQedM(ScalarField &weight, const double mass);
 private:
-    GridBase       *g_;
-    unsigned int   nd_;
-    LatticeInteger spNrm_;
-    ScalarField    latOne_, kHatSquared_;
-    SiteScalar     one_, z_;
-    Coordinate     zm_;
+    GridBase             *g_;
+    FFT                  *fft_;
+    std::unique_ptr<FFT> fftBuf_;
+    unsigned int         nd_;
+    LatticeInteger       spNrm_;
+    ScalarField          latOne_, kHatSquared_, r_;
+    GaugeField           aTilde_;
+    SiteScalar           one_, z_;
+    Coordinate           zm_;
 };
 
 // default alias
@@ -88,9 +99,15 @@ typedef TEmFieldGenerator<vComplex> EmFieldGenerator;
  ******************************************************************************/
 // constructor ////////////////////////////////////////////////////////////////
 template <typename VType>
-TEmFieldGenerator<VType>::TEmFieldGenerator(GridBase *g)
-: g_(g), nd_(g->Nd()), spNrm_(g), latOne_(g), kHatSquared_(g), zm_(g->Nd(), 0)
+TEmFieldGenerator<VType>::TEmFieldGenerator(GridBase *g, FFT *fft)
+: g_(g), fft_(fft), nd_(g->Nd()), spNrm_(g), latOne_(g), kHatSquared_(g), r_(g)
+, aTilde_(g), zm_(g->Nd(), 0)
 {
+    if (fft_ == nullptr)
+    {
+        fftBuf_.reset(new FFT(dynamic_cast<GridCartesian *>(g_)));
+        fft_ = fftBuf_.get();
+    }
     one_    = ComplexType(1., 0.);
     z_      = ComplexType(0., 0.);
     latOne_ = ComplexType(1., 0.);
@@ -209,26 +226,52 @@ template <typename VType>
 void TEmFieldGenerator<VType>::operator()(GaugeField &out, GridParallelRNG &rng, 
                                           const ScalarField &weight, TransformFn momSpaceTransform)
 {
-    ScalarField        r(g_), sqrtW(g_);
-    GaugeField         aTilde(g_);
-    FFT                fft(dynamic_cast<GridCartesian *>(g_));
-    double             vol = g_->gSites();
+    ScalarField sqrtW(g_);
+
+    makeSqrtWeight(sqrtW, weight);
+    generate(out, rng, sqrtW, momSpaceTransform);
+}
+
+template <typename VType>
+void TEmFieldGenerator<VType>::makeSqrtWeight(ScalarField &sqrtWeight, 
+                                              const ScalarField &weight)
+{
+    double vol = weight.Grid()->gSites();
+
+    sqrtWeight = sqrt(vol)*sqrt(weight);
+}
 
-    sqrtW = sqrt(vol)*sqrt(weight);
+template <typename VType>
+void TEmFieldGenerator<VType>::generate(GaugeField &out, GridParallelRNG &rng, 
+                                        const ScalarField &sqrtWeight, 
+                                        TransformFn momSpaceTransform)
+{
     for(unsigned int mu = 0; mu < nd_; mu++)
     {
-      gaussian(rng, r);
-      r = sqrtW*r;
-      pokeLorentz(aTilde, r, mu);
+      gaussian(rng, r_);
+      r_ = sqrtWeight*r_;
+      pokeLorentz(aTilde_, r_, mu);
     }
     if (momSpaceTransform != nullptr)
     {
-        momSpaceTransform(aTilde);
+        momSpaceTransform(aTilde_);
     }
-    fft.FFT_all_dim(out, aTilde, FFT::backward);
+    fft_->FFT_all_dim(out, aTilde_, FFT::backward);
     out = real(out);
 }
 
+template <typename VType>
+void TEmFieldGenerator<VType>::generate(std::vector<GaugeField> &out, 
+                                        GridParallelRNG &rng, 
+                                        const ScalarField &sqrtWeight, 
+                                        TransformFn momSpaceTransform)
+{
+    for (auto &a: out)
+    {
+        generate(a, rng, sqrtWeight, momSpaceTransform);
+    }
+}
+
 // QED_L weights //////////////////////////////////////////////////////////////
 template <typename VType>
 void TEmFieldGenerator<VType>::makeWeightsQedL(ScalarField &weight, 
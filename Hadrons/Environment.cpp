@@ -178,6 +178,29 @@ GridSerialRNG * Environment::getSerialRng(void)
     return rngSerial_.get();
 }
 
+// FFT /////////////////////////////////////////////////////////////////////////
+// Grid FFT objects build a communicator for their scalar grid at construction,
+// they are created once per grid and reused for any mask, direction and field
+// type on this grid
+FFT & Environment::getFft(GridBase *g)
+{
+    auto it = fft_.find(g);
+
+    if (it == fft_.end())
+    {
+        auto gc = dynamic_cast<GridCartesian *>(g);
+
+        if (gc == nullptr)
+        {
+            HADRONS_ERROR(Definition, "FFT needs a non-checkerboarded grid");
+        }
+        LOG(Debug) << "New FFT on grid " << g << std::endl;
+        it = fft_.emplace(g, FftPt(new FFT(gc))).first;
+    }
+
+    return *it->second;
+}
+
 // general memory management ///////////////////////////////////////////////////
 void Environment::addObject(const std::string name, const int moduleAddress)
 {
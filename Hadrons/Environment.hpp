@@ -75,6 +75,7 @@ public:
     typedef std::unique_ptr<GridRedBlackCartesian> GridRbPt;
     typedef std::unique_ptr<GridParallelRNG>       RngPt;
     typedef std::unique_ptr<GridSerialRNG>         SerialRngPt;
+    typedef std::unique_ptr<FFT>                   FftPt;
     GRID_SERIALIZABLE_ENUM(Storage, undef, standard, 0, cache, 1, temporary, 2);
 private:
     struct ObjInfo
@@ -122,6 +123,8 @@ public:
     // random number generator
     GridParallelRNG *       get4dRng(void);
     GridSerialRNG *         getSerialRng(void);
+    // FFT (one per grid, shared by all modules)
+    FFT &                   getFft(GridBase *g);
     // general memory management
     void                    addObject(const std::string name,
                                       const int moduleAddress = -1);
@@ -210,6 +213,8 @@ private:
     // random number generator
     RngPt                               rng4d_{nullptr};
     SerialRngPt                         rngSerial_{nullptr};
+    // FFT
+    std::map<GridBase *, FftPt>         fft_;
     // object store
     std::vector<ObjInfo>                object_;
     std::map<std::string, unsigned int> objectAddress_;
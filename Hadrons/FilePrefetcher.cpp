@@ -0,0 +1,206 @@
+/*
+ * FilePrefetcher.cpp, part of Hadrons (https://github.com/aportelli/Hadrons)
+ *
+ * Copyright (C) 2015 - 2023
+ *
+ * Author: Antonin Portelli <antonin.portelli@me.com>
+ *
+ * Hadrons is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Hadrons is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hadrons.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See the full license in the file "LICENSE" in the top level distribution 
+ * directory.
+ */
+
+/*  END LEGAL */
+
+#include <Hadrons/FilePrefetcher.hpp>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Grid;
+using namespace Hadrons;
+
+/******************************************************************************
+ *                       FilePrefetcher implementation                        *
+ ******************************************************************************/
+// destructor //////////////////////////////////////////////////////////////////
+FilePrefetcher::~FilePrefetcher(void)
+{
+    abort();
+}
+
+// prefetch control ////////////////////////////////////////////////////////////
+void FilePrefetcher::start(const std::vector<Range> &ranges)
+{
+    if (isRunning())
+    {
+        HADRONS_ERROR(Program, "file prefetch already running");
+    }
+    abort_.store(false, std::memory_order_release);
+    bytes_  = 0;
+    thread_ = std::thread([this, ranges](void)
+    {
+        for (auto &r: ranges)
+        {
+            if (abort_.load(std::memory_order_acquire))
+            {
+                break;
+            }
+            bytes_ += prefetch(r);
+        }
+    });
+}
+
+size_t FilePrefetcher::wait(void)
+{
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    return bytes_;
+}
+
+void FilePrefetcher::abort(void)
+{
+    abort_.store(true, std::memory_order_release);
+    wait();
+}
+
+bool FilePrefetcher::isRunning(void) const
+{
+    return thread_.joinable();
+}
+
+// file lists //////////////////////////////////////////////////////////////////
+std::vector<std::string> FilePrefetcher::expand(const std::vector<std::string> &paths)
+{
+    std::vector<std::string> files;
+    struct stat              s;
+
+    for (auto &p: paths)
+    {
+        if (stat(p.c_str(), &s) != 0)
+        {
+            continue;
+        }
+        if (S_ISREG(s.st_mode))
+        {
+            files.push_back(p);
+        }
+        else if (S_ISDIR(s.st_mode))
+        {
+            DIR           *dir = opendir(p.c_str());
+            struct dirent *entry;
+
+            if (dir == nullptr)
+            {
+                continue;
+            }
+            while ((entry = readdir(dir)) != nullptr)
+            {
+                std::string f = p + "/" + entry->d_name;
+
+                if ((stat(f.c_str(), &s) == 0) and S_ISREG(s.st_mode))
+                {
+                    files.push_back(f);
+                }
+            }
+            closedir(dir);
+        }
+    }
+
+    return files;
+}
+
+std::vector<FilePrefetcher::Range> 
+FilePrefetcher::share(const std::vector<std::string> &files, 
+                      const unsigned int node, const unsigned int nNode,
+                      const size_t stripe)
+{
+    std::vector<Range> ranges;
+    struct stat        s;
+    size_t             k = 0;
+
+    for (auto &f: files)
+    {
+        if (stat(f.c_str(), &s) != 0)
+        {
+            continue;
+        }
+        for (size_t offset = 0; offset < static_cast<size_t>(s.st_size); offset += stripe)
+        {
+            if (k % nNode == node)
+            {
+                size_t size = std::min(stripe, static_cast<size_t>(s.st_size) - offset);
+
+                // contiguous stripes of a file are merged
+                if (!ranges.empty() and (ranges.back().filename == f)
+                    and (ranges.back().offset + ranges.back().size == offset))
+                {
+                    ranges.back().size += size;
+                }
+                else
+                {
+                    ranges.push_back({f, offset, size});
+                }
+            }
+            k++;
+        }
+    }
+
+    return ranges;
+}
+
+size_t FilePrefetcher::totalSize(const std::vector<Range> &ranges)
+{
+    size_t size = 0;
+
+    for (auto &r: ranges)
+    {
+        size += r.size;
+    }
+
+    return size;
+}
+
+// prefetch one file range /////////////////////////////////////////////////////
+size_t FilePrefetcher::prefetch(const Range &range)
+{
+    size_t  bytes = 0;
+    ssize_t n;
+    int     fd = open(range.filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+#ifdef POSIX_FADV_WILLNEED
+    posix_fadvise(fd, range.offset, range.size, POSIX_FADV_SEQUENTIAL);
+    posix_fadvise(fd, range.offset, range.size, POSIX_FADV_WILLNEED);
+#endif
+    // some parallel file systems ignore the advice, so the range is read anyway
+    buf_.resize(HADRONS_PREFETCH_BUFFER);
+    while (!abort_.load(std::memory_order_acquire) and (bytes < range.size)
+           and ((n = pread(fd, buf_.data(), std::min(buf_.size(), range.size - bytes),
+                           range.offset + bytes)) > 0))
+    {
+        bytes += n;
+    }
+    close(fd);
+
+    return bytes;
+}
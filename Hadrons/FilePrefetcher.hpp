@@ -0,0 +1,92 @@
+/*
+ * FilePrefetcher.hpp, part of Hadrons (https://github.com/aportelli/Hadrons)
+ *
+ * Copyright (C) 2015 - 2023
+ *
+ * Author: Antonin Portelli <antonin.portelli@me.com>
+ *
+ * Hadrons is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Hadrons is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hadrons.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See the full license in the file "LICENSE" in the top level distribution 
+ * directory.
+ */
+
+/*  END LEGAL */
+
+
+#ifndef Hadrons_FilePrefetcher_hpp_
+#define Hadrons_FilePrefetcher_hpp_
+
+#include <Hadrons/Global.hpp>
+
+// size of the read buffer of the prefetcher thread (in bytes)
+#ifndef HADRONS_PREFETCH_BUFFER
+#define HADRONS_PREFETCH_BUFFER (16*1024*1024)
+#endif
+
+// size of the stripes distributed over the nodes (in bytes)
+#ifndef HADRONS_PREFETCH_STRIPE
+#define HADRONS_PREFETCH_STRIPE (64*1024*1024)
+#endif
+
+BEGIN_HADRONS_NAMESPACE
+
+/******************************************************************************
+ *                   Background file prefetcher class                         *
+ ******************************************************************************
+ * Reads a list of byte ranges of files (directories are expanded into their 
+ * regular files) on a background thread, so that they are cached when they
+ * are loaded later. The thread only uses POSIX I/O and its own buffer, it 
+ * does not communicate, log or touch any Grid object.
+ */
+class FilePrefetcher
+{
+public:
+    struct Range
+    {
+        std::string filename;
+        size_t      offset, size;
+    };
+public:
+    // constructor
+    FilePrefetcher(void) = default;
+    // destructor
+    virtual ~FilePrefetcher(void);
+    // prefetch control
+    void   start(const std::vector<Range> &ranges);
+    size_t wait(void);
+    void   abort(void);
+    bool   isRunning(void) const;
+    // regular files of a list of paths
+    static std::vector<std::string> expand(const std::vector<std::string> &paths);
+    // share of a node when the files are cut in stripes distributed 
+    // round-robin over nNode nodes, and total size of ranges (in bytes)
+    static std::vector<Range> share(const std::vector<std::string> &files,
+                                    const unsigned int node, 
+                                    const unsigned int nNode,
+                                    const size_t stripe = HADRONS_PREFETCH_STRIPE);
+    static size_t             totalSize(const std::vector<Range> &ranges);
+private:
+    // read a file range in the page cache, return the number of bytes read
+    size_t prefetch(const Range &range);
+private:
+    std::atomic<bool> abort_{false};
+    std::thread       thread_;
+    size_t            bytes_{0};
+    std::vector<char> buf_;
+};
+
+END_HADRONS_NAMESPACE
+
+#endif // Hadrons_FilePrefetcher_hpp_
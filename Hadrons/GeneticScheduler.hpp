@@ -41,17 +41,38 @@ class GeneticScheduler
 {
 public:
     typedef std::vector<T>                 Gene;
-    typedef std::pair<Gene *, Gene *>      GenePair;
+    typedef std::vector<V>                 Profile;
     typedef std::function<V(const Gene &)> ObjFunc;
+    // incremental objective function, fills an evaluation profile for the 
+    // gene given the profile of a parent sharing its first prefix elements
+    // (nullptr if not available), must be thread-safe
+    typedef std::function<V(Profile &, const Gene &, const Profile *,
+                            const unsigned int)> IncObjFunc;
     struct Parameters
     {
         double       mutationRate;
         unsigned int popSize, seed;
     };
+private:
+    struct Individual
+    {
+        Gene    gene;
+        Profile profile;
+    };
+    struct Candidate
+    {
+        Individual       ind;
+        const Individual *parent{nullptr};
+        unsigned int     prefix{0};
+        V                value;
+    };
+    typedef std::pair<Individual *, Individual *> IndividualPair;
 public:
-    // constructor
+    // constructors
     GeneticScheduler(Graph<T> &graph, const ObjFunc &func,
                      const Parameters &par);
+    GeneticScheduler(Graph<T> &graph, const IncObjFunc &func,
+                     const Parameters &par);
     // destructor
     virtual ~GeneticScheduler(void) = default;
     // access
@@ -77,19 +98,25 @@ public:
         return out;
     }
 private:
-    void doCrossover(void);
-    void doMutation(void);
+    void doCrossover(std::vector<Candidate> &cand);
+    void doMutation(std::vector<Candidate> &cand);
+    // parallel evaluation of the candidates and insertion in the population
+    void evaluate(std::vector<Candidate> &cand);
+    void insert(std::vector<Candidate> &cand);
+    V    evaluate(const Gene &g);
+    // set the parent with the longest common prefix with a candidate
+    static void setParent(Candidate &c, const Individual &p);
     // genetic operators
-    GenePair selectPair(void);
-    void     crossover(Gene &c1, Gene &c2, const Gene &p1, const Gene &p2);
-    void     mutation(Gene &m, const Gene &c);
+    IndividualPair selectPair(void);
+    void           crossover(Gene &c1, Gene &c2, const Gene &p1, const Gene &p2);
+    void           mutation(Gene &m, const Gene &c);
     
 private:
-    Graph<T>               &graph_;
-    const ObjFunc          &func_;
-    const Parameters       par_;
-    std::multimap<V, Gene> population_;
-    std::mt19937           gen_;
+    Graph<T>                     &graph_;
+    IncObjFunc                   func_;
+    const Parameters             par_;
+    std::multimap<V, Individual> population_;
+    std::mt19937                 gen_;
 };
 
 /******************************************************************************
@@ -99,6 +126,17 @@ private:
 template <typename V, typename T>
 GeneticScheduler<V, T>::GeneticScheduler(Graph<T> &graph, const ObjFunc &func,
                                       const Parameters &par)
+: GeneticScheduler(graph, 
+                   [func](Profile &, const Gene &g, const Profile *, 
+                          const unsigned int)->V
+                   {
+                       return func(g);
+                   }, par)
+{}
+
+template <typename V, typename T>
+GeneticScheduler<V, T>::GeneticScheduler(Graph<T> &graph, const IncObjFunc &func,
+                                      const Parameters &par)
 : graph_(graph)
 , func_(func)
 , par_(par)
@@ -111,7 +149,7 @@ template <typename V, typename T>
 const typename GeneticScheduler<V, T>::Gene &
 GeneticScheduler<V, T>::getMinSchedule(void)
 {
-    return population_.begin()->second;
+    return population_.begin()->second.gene;
 }
 
 template <typename V, typename T>
@@ -121,9 +159,14 @@ V GeneticScheduler<V, T>::getMinValue(void)
 }
 
 // breed a new generation //////////////////////////////////////////////////////
+// the random numbers are drawn sequentially and the candidates are evaluated 
+// in parallel, the result is independent of the number of threads and 
+// identical on all ranks with the same seed
 template <typename V, typename T>
 void GeneticScheduler<V, T>::nextGeneration(void)
 {
+    std::vector<Candidate> cand;
+
     // random initialization of the population if necessary
     if (population_.size() != par_.popSize)
     {
@@ -134,15 +177,19 @@ void GeneticScheduler<V, T>::nextGeneration(void)
     // random mutations
     for (unsigned int i = 0; i < par_.popSize; ++i)
     {
-        doMutation();
+        doMutation(cand);
     }
+    evaluate(cand);
+    insert(cand);
     //LOG(Debug) << "After mutations:\n" << *this << std::endl;
     
     // mating
     for (unsigned int i = 0; i < par_.popSize/2; ++i)
     {
-        doCrossover();
+        doCrossover(cand);
     }
+    evaluate(cand);
+    insert(cand);
     //LOG(Debug) << "After mating:\n" << *this << std::endl;
     
     // grim reaper
@@ -157,57 +204,103 @@ void GeneticScheduler<V, T>::nextGeneration(void)
 template <typename V, typename T>
 void GeneticScheduler<V, T>::initPopulation(void)
 {
+    std::vector<Candidate> cand(par_.popSize);
+
     population_.clear();
-    for (unsigned int i = 0; i < par_.popSize; ++i)
+    for (auto &c: cand)
     {
-        auto p = graph_.topoSort(gen_);
-        
-        population_.insert(std::make_pair(func_(p), p));
+        c.ind.gene = graph_.topoSort(gen_);
     }
+    evaluate(cand);
+    insert(cand);
 }
 
 template <typename V, typename T>
-void GeneticScheduler<V, T>::doCrossover(void)
+void GeneticScheduler<V, T>::doCrossover(std::vector<Candidate> &cand)
 {
-    auto p = selectPair();
-    Gene &p1 = *(p.first), &p2 = *(p.second);
-    Gene c1, c2;
+    auto      p = selectPair();
+    Candidate c1, c2;
     
-    crossover(c1, c2, p1, p2);
-    thread_critical
-    {
-        population_.insert(std::make_pair(func_(c1), c1));
-        population_.insert(std::make_pair(func_(c2), c2));
-    }
+    crossover(c1.ind.gene, c2.ind.gene, p.first->gene, p.second->gene);
+    setParent(c1, *(p.first));
+    setParent(c1, *(p.second));
+    setParent(c2, *(p.first));
+    setParent(c2, *(p.second));
+    cand.push_back(std::move(c1));
+    cand.push_back(std::move(c2));
 }
 
 template <typename V, typename T>
-void GeneticScheduler<V, T>::doMutation(void)
+void GeneticScheduler<V, T>::doMutation(std::vector<Candidate> &cand)
 {
     std::uniform_real_distribution<double>      mdis(0., 1.);
     std::uniform_int_distribution<unsigned int> pdis(0, population_.size() - 1);
     
     if (mdis(gen_) < par_.mutationRate)
     {
-        Gene m;
-        auto it = population_.begin();
+        Candidate m;
+        auto      it = population_.begin();
         
         std::advance(it, pdis(gen_));
-        mutation(m, it->second);
-	thread_critical
-        {
-            population_.insert(std::make_pair(func_(m), m));
-        }
+        mutation(m.ind.gene, it->second.gene);
+        setParent(m, it->second);
+        cand.push_back(std::move(m));
+    }
+}
+
+// evaluation //////////////////////////////////////////////////////////////////
+template <typename V, typename T>
+void GeneticScheduler<V, T>::evaluate(std::vector<Candidate> &cand)
+{
+    thread_for(i, cand.size(),
+    {
+        auto &c = cand[i];
+
+        c.value = func_(c.ind.profile, c.ind.gene, 
+                        c.parent ? &(c.parent->profile) : nullptr, c.prefix);
+    });
+}
+
+template <typename V, typename T>
+void GeneticScheduler<V, T>::insert(std::vector<Candidate> &cand)
+{
+    for (auto &c: cand)
+    {
+        population_.insert(std::make_pair(c.value, std::move(c.ind)));
+    }
+    cand.clear();
+}
+
+template <typename V, typename T>
+V GeneticScheduler<V, T>::evaluate(const Gene &g)
+{
+    Profile buf;
+
+    return func_(buf, g, nullptr, 0);
+}
+
+template <typename V, typename T>
+void GeneticScheduler<V, T>::setParent(Candidate &c, const Individual &p)
+{
+    auto         &g = c.ind.gene;
+    unsigned int n  = std::min(g.size(), p.gene.size());
+    unsigned int l  = std::mismatch(g.begin(), g.begin() + n, p.gene.begin()).first 
+                      - g.begin();
+
+    if (l > c.prefix)
+    {
+        c.parent = &p;
+        c.prefix = l;
     }
 }
 
 // genetic operators ///////////////////////////////////////////////////////////
 template <typename V, typename T>
-typename GeneticScheduler<V, T>::GenePair GeneticScheduler<V, T>::selectPair(void)
+typename GeneticScheduler<V, T>::IndividualPair GeneticScheduler<V, T>::selectPair(void)
 {
     std::vector<double> prob;
     unsigned int        ind;
-    Gene                *p1, *p2;
+    Individual          *p1, *p2;
     const double        max = population_.rbegin()->first;
     
 
@@ -307,7 +400,7 @@ void GeneticScheduler<V, T>::benchmarkCrossover(const unsigned int nIt)
         p1 = graph_.topoSort(gen_);
         p2 = graph_.topoSort(gen_);
         crossover(c1, c2, p1, p2);
-        improvement = (func_(c1) + func_(c2) - func_(p1) - func_(p2))/2;
+        improvement = (evaluate(c1) + evaluate(c2) - evaluate(p1) - evaluate(p2))/2;
         if (improvement < 0) neg++; else if (improvement == 0) eq++; else pos++;
     }
     total = neg + eq + pos;
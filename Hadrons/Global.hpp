@@ -34,6 +34,8 @@
 #define Hadrons_Global_hpp_
 
 #include <atomic>
+#include <future>
+#include <numeric>
 #include <set>
 #include <stack>
 #include <thread>
@@ -110,6 +110,131 @@ void sliceFill(Field &out, const Field &in, const unsigned int dir = 0,
     }
 }
 
+// extract a list of sites of a field, with a single collective for the whole
+// list (peekSite broadcasts every site separately)
+template <typename Field>
+void gatherSites(std::vector<typename Field::scalar_object> &out,
+                 const Field &field, const std::vector<Coordinate> &site)
+{
+    typedef typename Field::scalar_object sobj;
+    typedef typename Field::scalar_type   scalar;
+
+    GridBase           *g    = field.Grid();
+    const unsigned int nWord = sizeof(sobj)/sizeof(scalar);
+    const int          nsimd = g->Nsimd();
+    sobj               zero;
+
+    zero = Zero();
+    out.assign(site.size(), zero);
+    autoView(fv, field, CpuRead);
+    thread_for(i, site.size(),
+    {
+        int rank, oIndex, iIndex;
+
+        g->GlobalCoorToRankIndex(rank, oIndex, iIndex, site[i]);
+        if (rank == g->ThisRank())
+        {
+            const scalar *vp = reinterpret_cast<const scalar *>(&fv[oIndex]);
+            scalar       *sp = reinterpret_cast<scalar *>(&out[i]);
+
+            for (unsigned int w = 0; w < nWord; ++w)
+            {
+                sp[w] = vp[iIndex + w*nsimd];
+            }
+        }
+    });
+    g->GlobalSumVector(reinterpret_cast<scalar *>(out.data()),
+                       site.size()*nWord);
+}
+
+// list of the sites (p, t) for all momenta p and timeslices t, with the
+// momentum index running slowest, e.g. to gather time-momentum correlators
+inline std::vector<Coordinate> timeMomentumSites(const std::vector<std::vector<int>> &mom,
+                                                 const unsigned int nt,
+                                                 const unsigned int tDir)
+{
+    std::vector<Coordinate> site;
+
+    for (auto &p: mom)
+    {
+        Coordinate   x(p.size() + 1);
+        unsigned int j = 0;
+
+        for (unsigned int mu = 0; mu < x.size(); ++mu)
+        {
+            if (mu != tDir)
+            {
+                x[mu] = p[j];
+                j++;
+            }
+        }
+        for (unsigned int t = 0; t < nt; ++t)
+        {
+            x[tDir] = t;
+            site.push_back(x);
+        }
+    }
+
+    return site;
+}
+
+// volume sums of several fields, with a single collective for all of them
+template <typename Field>
+void batchSum(std::vector<typename Field::scalar_object> &out,
+              const std::vector<const Field *> &field)
+{
+    typedef typename Field::vector_object vobj;
+    typedef typename Field::scalar_object sobj;
+    typedef typename Field::scalar_type   scalar;
+
+    if (field.empty())
+    {
+        out.clear();
+        return;
+    }
+
+    GridBase                       *g     = field[0]->Grid();
+    const unsigned int             nField = field.size();
+    const unsigned int             nSite  = g->oSites();
+    const unsigned int             nChunk = std::min(static_cast<unsigned int>(GridThread::GetThreads()), nSite);
+    std::vector<std::vector<sobj>> part(nChunk, std::vector<sobj>(nField));
+    std::vector<LatticeView<vobj>> view;
+    sobj                           zero;
+
+    for (auto f: field)
+    {
+        conformable(f->Grid(), g);
+        view.push_back(f->View(CpuRead));
+    }
+    thread_for(c, nChunk,
+    {
+        for (unsigned int i = 0; i < nField; ++i)
+        {
+            vobj acc;
+
+            zeroit(acc);
+            for (unsigned int ss = c*nSite/nChunk; ss < (c + 1)*nSite/nChunk; ++ss)
+            {
+                acc += view[i][ss];
+            }
+            part[c][i] = Reduce(acc);
+        }
+    });
+    for (auto &v: view)
+    {
+        v.ViewClose();
+    }
+    zero = Zero();
+    out.assign(nField, zero);
+    for (auto &p: part)
+    for (unsigned int i = 0; i < nField; ++i)
+    {
+        out[i] += p[i];
+    }
+    g->GlobalSumVector(reinterpret_cast<scalar *>(out.data()),
+                       nField*sizeof(sobj)/sizeof(scalar));
+}
+
 END_HADRONS_NAMESPACE
 
 #endif // Hadrons_LatticeUtilities_hpp_
@@ -33,6 +33,7 @@
 #include <Hadrons/Global.hpp>
 #include <Hadrons/Database.hpp>
 #include <Hadrons/TimerArray.hpp>
+#include <Hadrons/PhaseCache.hpp>
 #include <Hadrons/VirtualMachine.hpp>
 
 BEGIN_HADRONS_NAMESPACE
@@ -100,6 +101,9 @@ HADRONS_MACRO_REDIRECT_12(__VA_ARGS__, envGetRbGrid5, envGetRbGrid4)(__VA_ARGS__
 #define envGetSliceGrid(latticeType, orthDim)\
 this->env().template getSliceGrid<typename latticeType::vector_type>(orthDim)
 
+#define envGetFft(latticeType)\
+this->env().getFft(envGetGrid(latticeType))
+
 #define envGet(type, name)\
 *this->env().template getObject<type>(name)
 
@@ -142,6 +146,12 @@ envCache(type, name, Ls, envGetGrid(type, Ls))
 #define envCacheLat(...)\
 HADRONS_MACRO_REDIRECT_23(__VA_ARGS__, envCacheLat5, envCacheLat4)(__VA_ARGS__)
 
+#define envCachePhase(type, mom)\
+this->template cachePhase<type>(mom)
+
+#define envGetPhase(type, mom)\
+this->template getPhase<type>(mom)
+
 #define envTmp(type, name, Ls, ...)\
 this->env().template createObject<type>(getName() + "_tmp_" + name,         \
                                   Environment::Storage::temporary, Ls, __VA_ARGS__)
@@ -187,6 +197,11 @@ public:
     {
         return std::vector<std::string>(0);
     };
+    // files read by the module for a given trajectory, used for prefetching
+    virtual std::vector<std::string> getInputFiles(const unsigned int traj)
+    {
+        return std::vector<std::string>(0);
+    };
     virtual DependencyMap getObjectDependencies(void)
     {
         return DependencyMap();
@@ -223,6 +238,11 @@ protected:
     GridBase *getGrid(const bool redBlack = false, const unsigned int Ls = 1);
     template <typename Field>
     GridBase *getGrid(const unsigned int Ls);
+    // shared momentum phases (declared in setup, used in execute)
+    template <typename Field>
+    void cachePhase(const std::vector<Real> &mom);
+    template <typename Field>
+    const Field &getPhase(const std::vector<Real> &mom);
     // get RNGs seeded from module string
     GridParallelRNG &rng4d(void);
     GridSerialRNG &rngSerial(void);
@@ -382,6 +402,27 @@ GridBase *ModuleBase::getGrid(const unsigned int Ls)
     return getGrid<Field>(false, Ls);
 }
 
+template <typename Field>
+void ModuleBase::cachePhase(const std::vector<Real> &mom)
+{
+    GridBase          *g   = getGrid4d<Field>();
+    const std::string name = PhaseCache<Field>::name(mom, g);
+
+    if (!env().hasCreatedObject(name))
+    {
+        env().template createObject<PhaseCache<Field>>(name, Environment::Storage::standard, 1, g);
+    }
+    vm().addSharedObjectUser(env().getObjectAddress(name), vm().getModuleAddress(getName()));
+}
+
+template <typename Field>
+const Field & ModuleBase::getPhase(const std::vector<Real> &mom)
+{
+    const std::string name = PhaseCache<Field>::name(mom, getGrid4d<Field>());
+
+    return env().template getObject<PhaseCache<Field>>(name)->get(mom);
+}
+
 template <typename P>
 Module<P>::Module(const std::string name)
 : ModuleBase(name)
@@ -30,3 +30,4 @@ using namespace Hadrons;
 using namespace MContraction;
 
 template class HADRONS_NAMESPACE::MContraction::TA2ALoop<FIMPL>;
+template class HADRONS_NAMESPACE::MContraction::TA2ALoop<FIMPL, FIMPLF>;
@@ -32,6 +32,11 @@
 #include <Hadrons/Module.hpp>
 #include <Hadrons/ModuleFactory.hpp>
 
+// default number of modes accumulated per sweep of the loop field
+#ifndef HADRONS_A2A_LOOP_BLOCK
+#define HADRONS_A2A_LOOP_BLOCK 16
+#endif
+
 BEGIN_HADRONS_NAMESPACE
 
 /******************************************************************************
@@ -43,15 +48,18 @@ class A2ALoopPar: Serializable
 {
 public:
     GRID_SERIALIZABLE_CLASS_MEMBERS(A2ALoopPar,
-                                    std::string, left,
-                                    std::string, right);
+                                    std::string,  left,
+                                    std::string,  right,
+                                    unsigned int, blockSize);
+    A2ALoopPar(void): blockSize{0} {};
 };
 
-template <typename FImpl>
+template <typename FImpl, typename FImplIn = FImpl>
 class TA2ALoop: public Module<A2ALoopPar>
 {
 public:
     FERM_TYPE_ALIASES(FImpl,);
+    FERM_TYPE_ALIASES(FImplIn, In);
 public:
     // constructor
     TA2ALoop(const std::string name);
@@ -64,30 +72,50 @@ public:
     virtual void setup(void);
     // execution
     virtual void execute(void);
+private:
+    // pointers to a block of input vectors in the output precision
+    static void castBlock(std::vector<const FermionField *> &block,
+                          std::vector<FermionField> *buf,
+                          const std::vector<FermionField> &vec,
+                          const unsigned int i0);
+    template <typename FieldIn>
+    static void castBlock(std::vector<const FermionField *> &block,
+                          std::vector<FermionField> *buf,
+                          const std::vector<FieldIn> &vec,
+                          const unsigned int i0);
+    // loop (+)= sum_i left[i] x right[i]^dagger in a single sweep
+    static void accumulate(PropagatorField &loop,
+                           const std::vector<const FermionField *> &left,
+                           const std::vector<const FermionField *> &right,
+                           const bool first);
+private:
+    unsigned int blockSize_;
+    bool         mixed_;
 };
 
 MODULE_REGISTER_TMP(A2ALoop, TA2ALoop<FIMPL>, MContraction);
+MODULE_REGISTER_TMP(A2ALoopMixed, ARG(TA2ALoop<FIMPL, FIMPLF>), MContraction);
 
 /******************************************************************************
  *                        TA2ALoop implementation                             *
  ******************************************************************************/
 // constructor /////////////////////////////////////////////////////////////////
-template <typename FImpl>
-TA2ALoop<FImpl>::TA2ALoop(const std::string name)
+template <typename FImpl, typename FImplIn>
+TA2ALoop<FImpl, FImplIn>::TA2ALoop(const std::string name)
 : Module<A2ALoopPar>(name)
 {}
 
 // dependencies/products ///////////////////////////////////////////////////////
-template <typename FImpl>
-std::vector<std::string> TA2ALoop<FImpl>::getInput(void)
+template <typename FImpl, typename FImplIn>
+std::vector<std::string> TA2ALoop<FImpl, FImplIn>::getInput(void)
 {
     std::vector<std::string> in = {par().left, par().right};
     
     return in;
 }
 
-template <typename FImpl>
-std::vector<std::string> TA2ALoop<FImpl>::getOutput(void)
+template <typename FImpl, typename FImplIn>
+std::vector<std::string> TA2ALoop<FImpl, FImplIn>::getOutput(void)
 {
     std::vector<std::string> out = {getName()};
     
@@ -95,24 +123,149 @@ std::vector<std::string> TA2ALoop<FImpl>::getOutput(void)
 }
 
 // setup ///////////////////////////////////////////////////////////////////////
-template <typename FImpl>
-void TA2ALoop<FImpl>::setup(void)
+template <typename FImpl, typename FImplIn>
+void TA2ALoop<FImpl, FImplIn>::setup(void)
 {
+    blockSize_ = (par().blockSize > 0) ? par().blockSize : HADRONS_A2A_LOOP_BLOCK;
+    mixed_     = !std::is_same<FermionField, FermionFieldIn>::value;
     envCreateLat(PropagatorField, getName());
+    if (mixed_)
+    {
+        envTmp(std::vector<FermionField>, "leftTmp", 1, blockSize_, 
+               envGetGrid(FermionField));
+        envTmp(std::vector<FermionField>, "rightTmp", 1, blockSize_, 
+               envGetGrid(FermionField));
+    }
+}
+
+// input casting ///////////////////////////////////////////////////////////////
+template <typename FImpl, typename FImplIn>
+void TA2ALoop<FImpl, FImplIn>::castBlock(std::vector<const FermionField *> &block,
+                                         std::vector<FermionField> *buf,
+                                         const std::vector<FermionField> &vec,
+                                         const unsigned int i0)
+{
+    for (unsigned int i = 0; i < block.size(); ++i)
+    {
+        block[i] = &vec[i0 + i];
+    }
+}
+
+template <typename FImpl, typename FImplIn>
+template <typename FieldIn>
+void TA2ALoop<FImpl, FImplIn>::castBlock(std::vector<const FermionField *> &block,
+                                         std::vector<FermionField> *buf,
+                                         const std::vector<FieldIn> &vec,
+                                         const unsigned int i0)
+{
+    for (unsigned int i = 0; i < block.size(); ++i)
+    {
+        precisionChange((*buf)[i], vec[i0 + i]);
+        block[i] = &(*buf)[i];
+    }
+}
+
+// loop kernel /////////////////////////////////////////////////////////////////
+// All the modes of a block are accumulated site by site in a local 
+// propagator object, so that the loop field is read and written once per
+// block rather than the 3 sweeps per mode of loop += outerProduct(l, r).
+// On GPU builds the Grid expression is used.
+template <typename FImpl, typename FImplIn>
+void TA2ALoop<FImpl, FImplIn>::accumulate(PropagatorField &loop,
+                                          const std::vector<const FermionField *> &left,
+                                          const std::vector<const FermionField *> &right,
+                                          const bool first)
+{
+#if defined(GRID_CUDA) || defined(GRID_HIP) || defined(GRID_SYCL)
+    if (first)
+    {
+        loop = Zero();
+    }
+    for (unsigned int i = 0; i < left.size(); ++i)
+    {
+        loop += outerProduct(*left[i], *right[i]);
+    }
+#else
+    typedef typename PropagatorField::vector_object vobj;
+    typedef decltype(left[0]->View(CpuRead))        View;
+
+    const unsigned int nMode = left.size();
+    std::vector<View>  leftV, rightV;
+
+    for (unsigned int i = 0; i < nMode; ++i)
+    {
+        leftV.push_back(left[i]->View(CpuRead));
+        rightV.push_back(right[i]->View(CpuRead));
+    }
+    autoView(loopV, loop, CpuWrite);
+    thread_for(ss, loop.Grid()->oSites(),
+    {
+        vobj acc;
+
+        if (first)
+        {
+            zeroit(acc);
+        }
+        else
+        {
+            acc = loopV[ss];
+        }
+        for (unsigned int i = 0; i < nMode; ++i)
+        {
+            acc += outerProduct(leftV[i][ss], rightV[i][ss]);
+        }
+        loopV[ss] = acc;
+    });
+    for (unsigned int i = 0; i < nMode; ++i)
+    {
+        leftV[i].ViewClose();
+        rightV[i].ViewClose();
+    }
+#endif
 }
 
 // execution ///////////////////////////////////////////////////////////////////
-template <typename FImpl>
-void TA2ALoop<FImpl>::execute(void)
+template <typename FImpl, typename FImplIn>
+void TA2ALoop<FImpl, FImplIn>::execute(void)
 {
     auto &loop  = envGet(PropagatorField, getName());
-    auto &left  = envGet(std::vector<FermionField>, par().left);
-    auto &right = envGet(std::vector<FermionField>, par().right);
+    auto &left  = envGet(std::vector<FermionFieldIn>, par().left);
+    auto &right = envGet(std::vector<FermionFieldIn>, par().right);
+    std::vector<FermionField>        *leftBuf = nullptr, *rightBuf = nullptr;
+    std::vector<const FermionField *> leftBlock, rightBlock;
 
-    loop = Zero();
-    for (unsigned int i = 0; i < left.size(); ++i)
+    if (left.size() != right.size())
     {
-        loop += outerProduct(left[i], right[i]);
+        HADRONS_ERROR(Size, "left and right vector sets have different sizes ("
+                      + std::to_string(left.size()) + " and " 
+                      + std::to_string(right.size()) + ")");
+    }
+    if (mixed_)
+    {
+        envGetTmp(std::vector<FermionField>, leftTmp);
+        envGetTmp(std::vector<FermionField>, rightTmp);
+        leftBuf  = &leftTmp;
+        rightBuf = &rightTmp;
+    }
+    LOG(Message) << "Computing loop from " << left.size() << " modes (blocks of "
+                 << blockSize_ << ")" << std::endl;
+    if (left.empty())
+    {
+        loop = Zero();
+    }
+    for (unsigned int i = 0; i < left.size(); i += blockSize_)
+    {
+        unsigned int n = std::min(blockSize_, static_cast<unsigned int>(left.size()) - i);
+
+        leftBlock.resize(n);
+        rightBlock.resize(n);
+        startTimer("Cast");
+        castBlock(leftBlock, leftBuf, left, i);
+        castBlock(rightBlock, rightBuf, right, i);
+        stopTimer("Cast");
+        startTimer("Loop kernel");
+        accumulate(loop, leftBlock, rightBlock, i == 0);
+        stopTimer("Loop kernel");
     }
 }
 
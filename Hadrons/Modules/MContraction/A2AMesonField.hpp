@@ -209,7 +209,6 @@ void TA2AMesonField<FImpl>::setup(void)
     }
     envCache(std::vector<ComplexField>, momphName_, 1, 
              par().mom.size(), envGetGrid(ComplexField));
-    envTmpLat(ComplexField, "coor");
     envTmp(Computation, "computation", 1, envGetGrid(FermionField), 
            env().getNd() - 1, mom_.size(), gamma_.size(), par().block, 
            par().cacheBlock, this);
@@ -258,17 +257,7 @@ void TA2AMesonField<FImpl>::execute(void)
         startTimer("Momentum phases");
         for (unsigned int j = 0; j < nmom; ++j)
         {
-            Complex           i(0.0,1.0);
-            std::vector<Real> p;
-
-            envGetTmp(ComplexField, coor);
-            ph[j] = Zero();
-            for(unsigned int mu = 0; mu < mom_[j].size(); mu++)
-            {
-                LatticeCoordinate(coor, mu);
-                ph[j] = ph[j] + (mom_[j][mu]/env().getDim(mu))*coor;
-            }
-            ph[j] = exp((Real)(2*M_PI)*i*ph[j]);
+            PhaseCache<ComplexField>::build(ph[j], mom_[j]);
         }
         hasPhase_ = true;
         stopTimer("Momentum phases");
@@ -279,7 +279,6 @@ void TA2ASmearedMesonField<FImpl>::setup(void)
     envTmp(Computation, "computation", 1, envGetGrid(FermionField),
             env().getNd() - 1, smear_size, gamma_.size(), par().block,
             par().cacheBlock, this);
-    envTmp(FFT, "fft", 1, env().getGrid());
 
     auto &left_orig=envGet(std::vector<FermionField>, par().left);
     auto &right_orig=envGet(std::vector<FermionField>, par().right);
@@ -314,7 +313,7 @@ void TA2ASmearedMesonField<FImpl>::execute(void)
     }
 
     auto &distrib=envGet(std::vector<ComplexField>, distributionsCache_);
-    envGetTmp(FFT, fft);
+    auto &fft=env().getFft(env().getGrid());
     envGetTmp(std::vector<ComplexField>, smear_weight);
 
     int nt         = env().getDim().back();
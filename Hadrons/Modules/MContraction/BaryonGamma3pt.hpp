@@ -166,7 +166,6 @@ public:
     virtual void parseGammaLRString(std::string gammas, std::vector<GammaABPair> &gammaList);
 
     std::vector<Real> mom_;
-    std::string momphName_;
 protected:
     // setup
     virtual void setup(void);
@@ -182,8 +181,7 @@ MODULE_REGISTER_TMP(BaryonGamma3pt, ARG(TBaryonGamma3pt<FIMPL>), MContraction);
 // constructor /////////////////////////////////////////////////////////////////
 template <typename FImpl>
 TBaryonGamma3pt<FImpl>::TBaryonGamma3pt(const std::string name)
-: Module<BaryonGamma3ptPar>(name),
-  momphName_ (name + "_momph")
+: Module<BaryonGamma3ptPar>(name)
 {}
 
 // dependencies/products ///////////////////////////////////////////////////////
@@ -241,8 +239,10 @@ void TBaryonGamma3pt<FImpl>::setup(void)
     mom_      = parse_vector(par().mom, env().getNd()-1, "momentum");
 
     envTmpLat(SpinMatrixField, "c");
-    envTmpLat(LatticeComplex, "coor");
-    envCacheLat(LatticeComplex, momphName_);
+    if (mom_[0] != 0 || mom_[1] != 0 || mom_[2] != 0) 
+    {
+        envCachePhase(LatticeComplex, mom_);
+    }
     envCreate(HadronsSerializable, getName(), 1, 0);
 }
 
@@ -483,22 +483,12 @@ void TBaryonGamma3pt<FImpl>::execute(void)
                 }
             }
         
-            auto &ph = envGet(LatticeComplex, momphName_);
-        
             if (mom_[0] != 0 || mom_[1] != 0 || mom_[2] != 0) 
             {
                 LOG(Message) << "Adding momentum phase " << mom_ << std::endl;
 
-                Complex           i(0.0,1.0);
+                auto &ph = envGetPhase(LatticeComplex, mom_);
 
-                envGetTmp(LatticeComplex, coor);
-                ph = Zero();
-                for(unsigned int mu = 0; mu < 3; mu++)
-                {
-                    LatticeCoordinate(coor, mu);
-                    ph = ph + (mom_[mu]/env().getDim(mu))*coor;
-                }
-                ph = exp((Real)(2*M_PI)*i*ph);
                 c = ph*c;
             }
 
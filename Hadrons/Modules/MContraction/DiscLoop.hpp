@@ -200,7 +200,7 @@ void TDiscLoop<FImpl>::execute(void)
     SitePropagator                     buf;
     std::vector<std::vector<SlicedOp>> slicedOp;
     std::vector<std::vector<Result>>   result;
-    FFT                                fft(envGetGrid(PropagatorField));
+    auto                               &fft    = envGetFft(PropagatorField);
     std::vector<int>                   dMask(nd, 1);
 
     dMask[nd - 1] = 0;
@@ -225,7 +225,9 @@ void TDiscLoop<FImpl>::execute(void)
     {
         Gamma gamma(gammaList[g]);
         op = gamma*q_loop;
+        startTimer("Fourier transform");
         fft.FFT_dim_mask(ftBuf, op, dMask, FFT::forward);
+        stopTimer("Fourier transform");
         slicedOp[g].resize(nmom);
         for (unsigned int m = 0; m < nmom; ++m)
         {
@@ -251,7 +251,6 @@ void TDistilMesonFieldFixed<FImpl>::setup(void)
     }
 
     unsigned int nExt = momenta_.size() , nStr = gamma_.size();
-    envTmpLat(ComplexField,             "coor");
     envTmp(std::vector<ComplexField>,   "phase",        1, nExt, g );
     envTmp(DistilVector,                "dvl",          1, DISTILVECTOR_TIME_BATCH_SIZE*dilSizeLS_.at(Side::left), g);
     envTmp(DistilVector,                "dvr",          1, par().cacheSize, g);
@@ -413,17 +412,9 @@ void TDistilMesonFieldFixed<FImpl>::execute(void)
     }
 
     startTimer("momentum phases");
-    envGetTmp(ComplexField, coor);
-    Complex           i(0.0,1.0);
     for (unsigned int j = 0; j < momenta_.size(); ++j)
     {
-        phase[j] = Zero();
-        for(unsigned int mu = 0; mu < momenta_[j].size(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            phase[j] = phase[j] + (momenta_[j][mu]/env().getDim()[mu])*coor;
-        }
-        phase[j] = exp((Real)(2*M_PI)*i*phase[j]);
+        PhaseCache<ComplexField>::build(phase[j], momenta_[j]);
     }
     stopTimer("momentum phases");
     
@@ -272,7 +272,6 @@ void TDistilMesonFieldRelative<FImpl>::setup(void)
     }
     
     unsigned int nExt = momenta_.size() , nStr = gamma_.size();
-    envTmpLat(ComplexField,             "coor");
     envTmp(std::vector<ComplexField>,   "phase",        1, nExt, g );
     //make dv's aware of anchor/relative sides and cached size also (anchored side is being compute in cache loop
     unsigned int left_dv_size  = (Side::left==relative_side_)   ? dilSizeLS_.at(relative_side_)    : par().cacheSize ;
@@ -438,17 +437,9 @@ void TDistilMesonFieldRelative<FImpl>::execute(void)
     }
 
     startTimer("momentum phases");
-    envGetTmp(ComplexField, coor);
-    Complex           i(0.0,1.0);
     for (unsigned int j = 0; j < momenta_.size(); ++j)
     {
-        phase[j] = Zero();
-        for(unsigned int mu = 0; mu < momenta_[j].size(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            phase[j] = phase[j] + (momenta_[j][mu]/env().getDim()[mu])*coor;
-        }
-        phase[j] = exp((Real)(2*M_PI)*i*phase[j]);
+        PhaseCache<ComplexField>::build(phase[j], momenta_[j]);
     }
     stopTimer("momentum phases");
     
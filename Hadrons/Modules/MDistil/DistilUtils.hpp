@@ -122,6 +122,39 @@ inline std::string timeslicesDump(const std::vector<unsigned int> ts)
     return ss.str();
 };
 
+// copy the local data of a field into the columns of a matrix, to compute
+// projections with matrix products. The data of each site is split in nBlock
+// contiguous blocks of equal size (e.g. the spin components of a fermion),
+// block b is copied into the column col + b. Rows follow the memory layout of
+// the field, so that fields with the same grid and inner block type give rows
+// in the same order.
+template <typename Field, typename Mat>
+inline void fieldToColumns(Mat &mat, const Field &field, const Eigen::Index col,
+                           const unsigned int nBlock = 1)
+{
+    typedef typename Field::vector_object vobj;
+    typedef typename Field::scalar_type   scalar;
+
+    const Eigen::Index nSite     = field.Grid()->oSites();
+    const Eigen::Index blockSize = sizeof(vobj)/sizeof(scalar)/nBlock;
+
+    if (mat.rows() != nSite*blockSize)
+    {
+        HADRONS_ERROR(Size, "matrix row number does not match field size");
+    }
+    autoView(fv, field, CpuRead);
+    thread_for(ss, nSite,
+    {
+        const scalar *site = reinterpret_cast<const scalar *>(&fv[ss]);
+
+        for (unsigned int b = 0; b < nBlock; ++b)
+        for (Eigen::Index i = 0; i < blockSize; ++i)
+        {
+            mat(ss*blockSize + i, col + b) = site[b*blockSize + i];
+        }
+    });
+}
+
 END_MODULE_NAMESPACE
 END_HADRONS_NAMESPACE
 #endif
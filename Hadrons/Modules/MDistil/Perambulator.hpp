@@ -95,6 +95,9 @@ public:
     // execution
     virtual void execute(void);
 protected:
+    typedef typename FermionField::scalar_type        Scalar;
+    typedef Eigen::Matrix<Scalar, -1, -1>             ProjMatrix;
+    typedef Eigen::Map<ProjMatrix>                    ProjMap;
     unsigned int Ls_;
 };
 
@@ -212,11 +215,12 @@ void TPerambulator<FImpl>::setup(void)
     }
 
     envTmp(FermionField,         "fermion3dtmp", 1, grid3d);
-    envTmpLat(ColourVectorField, "cv4dtmp");
-    envTmp(ColourVectorField,    "cv3dtmp", 1, grid3d);
     envTmp(ColourVectorField,    "evec3d",  1, grid3d);
     const int Ntlocal{grid4d->LocalDimensions()[3]};
-    envTmp(std::vector<ColourVectorField>,    "evec3d_tmp",  1, Ntlocal * nVec,  grid3d);
+    const Eigen::Index nRow{grid3d->lSites() * Nc};
+    envTmp(std::vector<ProjMatrix>, "evecMat", 1, Ntlocal, ProjMatrix(nRow, nVec));
+    envTmp(ProjMatrix,              "solMat",  1, nRow, Ns * sourceBatchSize);
+    envTmp(std::vector<Scalar>,     "projBuf", 1, Ntlocal * nVec * Ns * sourceBatchSize);
 
     // No solver needed if an already existing solve is recycled    
     if(perambMode != pMode::inputSolve)
@@ -261,22 +265,22 @@ void TPerambulator<FImpl>::execute(void)
     LOG(Message)<< "Source batch size = " << par().sourceBatchSize << std::endl;
 
     envGetTmp(FermionField,      fermion3dtmp);
-    envGetTmp(ColourVectorField, cv4dtmp);
-    envGetTmp(ColourVectorField, cv3dtmp);
     envGetTmp(ColourVectorField, evec3d);
     GridCartesian * grid4d = envGetGrid(FermionField);
     GridCartesian * grid3d = envGetSliceGrid(FermionField,grid4d->Nd() -1);
     const int Ntlocal{grid4d->LocalDimensions()[3]};
     const int Ntfirst{grid4d->LocalStarts()[3]};
 
-    envGetTmp(std::vector<ColourVectorField>, evec3d_tmp);
+    // timeslice-local eigenvectors, one matrix column per eigenvector
+    envGetTmp(std::vector<ProjMatrix>, evecMat);
+    envGetTmp(ProjMatrix,              solMat);
+    envGetTmp(std::vector<Scalar>,     projBuf);
     for (int t = Ntfirst; t < Ntfirst + Ntlocal; t++)
     {
         for (int ivec = 0; ivec < nVec; ivec++)
         {
-            int jvec= ivec + nVec * (t-Ntfirst);
             ExtractSliceLocal(evec3d,epack.evec[ivec],0,t-Ntfirst,Tdir);
-            evec3d_tmp[jvec] = evec3d;
+            fieldToColumns(evecMat[t-Ntfirst], evec3d, ivec);
         }
     }
 
@@ -416,7 +420,22 @@ void TPerambulator<FImpl>::execute(void)
                     }
                 }
             }
+            // projection on the eigenvectors: for each local timeslice, one
+            // matrix product of the eigenvectors with all the spin components
+            // of the batch solutions, then a single reduction for all of them
             START_P_TIMER("perambulator computation");
+            const int nCol = Ns * sourceBatchSize;
+            for (int t = Ntfirst; t < Ntfirst + Ntlocal; t++)
+            {
+                for (iSource = 0; iSource < sourceBatchSize; iSource ++)
+                {
+                    ExtractSliceLocal(fermion3dtmp,fermion4dtmp_vec[iSource],0,t-Ntfirst,Tdir);
+                    fieldToColumns(solMat, fermion3dtmp, Ns * iSource, Ns);
+                }
+                ProjMap proj(projBuf.data() + (t-Ntfirst) * nVec * nCol, nVec, nCol);
+                proj.noalias() = evecMat[t-Ntfirst].adjoint() * solMat;
+            }
+            grid3d->GlobalSumVector(projBuf.data(), projBuf.size());
             for (iSource = 0; iSource < sourceBatchSize; iSource ++)
             {
                 int in = sourceIndices[iSource] % nNoise;
@@ -427,18 +446,13 @@ void TPerambulator<FImpl>::execute(void)
                 ds = index[DistillationNoise<FImpl>::Index::s];
                 std::vector<int>::iterator it = std::find(std::begin(invT), std::end(invT), dt);
                 idt=it - std::begin(invT);
-                for (int is = 0; is < Ns; is++)
+                for (int t = Ntfirst; t < Ntfirst + Ntlocal; t++)
                 {
-                    cv4dtmp = peekSpin(fermion4dtmp_vec[iSource],is);
-                    for (int t = Ntfirst; t < Ntfirst + Ntlocal; t++)
+                    ProjMap proj(projBuf.data() + (t-Ntfirst) * nVec * nCol, nVec, nCol);
+                    for (int is = 0; is < Ns; is++)
+                    for (int ivec = 0; ivec < nVec; ivec++)
                     {
-                        ExtractSliceLocal(cv3dtmp,cv4dtmp,0,t-Ntfirst,Tdir); 
-                        for (int ivec = 0; ivec < nVec; ivec++)
-                        {
-                            int jvec= ivec + nVec * (t-Ntfirst);
-                            evec3d = evec3d_tmp[jvec];
-                            pokeSpin(perambulator.tensor(t, ivec, dk, in,idt,ds),static_cast<Complex>(innerProduct(evec3d, cv3dtmp)),is);
-                        }
+                        pokeSpin(perambulator.tensor(t, ivec, dk, in,idt,ds),static_cast<Complex>(proj(ivec, Ns * iSource + is)),is);
                     }
                 }
             }
@@ -453,7 +467,6 @@ void TPerambulator<FImpl>::execute(void)
     {
         START_P_TIMER("perambulator sharing");
         LOG(Debug) <<  "Sharing perambulator data with other nodes" << std::endl;
-        const int MySlice {grid4d->_processor_coor[Tdir]};
         const int TensorSize {static_cast<int>(perambulator.tensor.size() * PerambTensor::Traits::count)};
         if (TensorSize != perambulator.tensor.size() * PerambTensor::Traits::count)
         {
@@ -462,6 +475,25 @@ void TPerambulator<FImpl>::execute(void)
         const int SliceCount {TensorSize/NumSlices};
         using InnerScalar = typename PerambTensor::Traits::scalar_type;
         InnerScalar * const PerambData {EigenIO::getFirstScalar( perambulator.tensor )};
+        const int MySlice {grid4d->_processor_coor[Tdir]};
+#if defined (GRID_COMMS_MPI) || defined (GRID_COMMS_MPI3) || defined (GRID_COMMS_MPIT)
+        // All the nodes of a 3d slice hold the data of their timeslices, which
+        // are gathered in place along the time direction only: the ranks of 
+        // the time communicator are ordered by their time coordinate, so the
+        // contribution of each rank is already at its place in the tensor.
+        Coordinate row(grid4d->_ndimension, 1);
+        int        sliceRank;
+
+        row[Tdir] = grid4d->_processors[Tdir];
+        CartesianCommunicator sliceComm(row, *grid4d, sliceRank);
+        const size_t SliceBytes {SliceCount * sizeof(InnerScalar)};
+        if (SliceBytes > static_cast<size_t>(std::numeric_limits<int>::max()))
+        {
+            HADRONS_ERROR(Range, "peramb slice size overflow");
+        }
+        MPI_Allgather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, PerambData, 
+                      static_cast<int>(SliceBytes), MPI_BYTE, sliceComm.communicator);
+#else
         // Zero data for all timeslices other than the slice computed by 3d boss nodes
         for (int Slice = 0 ; Slice < NumSlices ; ++Slice)
         {
@@ -475,13 +507,22 @@ void TPerambulator<FImpl>::execute(void)
             }
         }
         grid4d->GlobalSumVector(PerambData, TensorSize);
+#endif
         STOP_P_TIMER("perambulator sharing");
     }
 
-    // Save the perambulator to disk from the boss node
-    if (grid4d->IsBoss() && !par().perambOutFileName.empty())
+    // Save the perambulator to disk, the files of the different time sources
+    // are distributed over the boss nodes of the 3d slices
+    if (!par().perambOutFileName.empty())
     {
         START_P_TIMER("perambulator io");
+        const int MySlice{grid4d->_processor_coor[Tdir]};
+        std::string sPerambDir {par().perambOutFileName};
+        sPerambDir.append(".");
+        sPerambDir.append(std::to_string(vm().getTrajectory()));
+        sPerambDir.append("/");
+        makeFileDir(sPerambDir, grid4d);
+        grid4d->Barrier();
         envGetTmp(PerambIndexTensor, PerambDT);
         std::vector<std::string> nHash = dilNoise.generateHash();
         PerambDT.MetaData.noiseHashes = nHash;
@@ -494,8 +535,12 @@ void TPerambulator<FImpl>::execute(void)
             {
                 continue;
             }
-            LOG(Message) <<  "saving perambulator dt= " << dt << std::endl;
             idt=it - std::begin(invT);
+            LOG(Message) <<  "saving perambulator dt= " << dt << " from slice " << idt % NumSlices << std::endl;
+            if (!grid3d->IsBoss() || idt % NumSlices != MySlice)
+            {
+                continue;
+            }
             std::string sPerambName {par().perambOutFileName};
             sPerambName.append(".");
             sPerambName.append(std::to_string(vm().getTrajectory()));
@@ -503,7 +548,6 @@ void TPerambulator<FImpl>::execute(void)
             sPerambName.append(std::to_string(dt));
             sPerambName.append(".");
             sPerambName.append(std::to_string(vm().getTrajectory()));
-            makeFileDir(sPerambName, grid4d);
             for (int t = 0; t < Nt; t++)
             for (int ivec = 0; ivec < nVec; ivec++)
             for (int idl = 0; idl < nDL_reduced; idl++)
@@ -47,9 +47,13 @@ BEGIN_MODULE_NAMESPACE(MFermion)
 class GaugePropPar: Serializable
 {
 public:
+    GaugePropPar(void): batchSize{0} {};
+public:
+    // batchSize: number of spin-colour sources solved together (0 for all)
     GRID_SERIALIZABLE_CLASS_MEMBERS(GaugePropPar,
                                     std::string, source,
-                                    std::string, solver);
+                                    std::string, solver,
+                                    unsigned int, batchSize);
 };
 
 template <typename FImpl>
@@ -75,8 +79,16 @@ private:
     void solvePropagator(std::vector<PropagatorField *> &prop, 
                          std::vector<PropagatorField *> &propPhysical,
                          const std::vector<PropagatorField *> &fullSrc);
+    // import/export the spin-colour components [first, first + n)
+    void importSources(std::vector<FermionField> &source, FermionField &tmp,
+                       const std::vector<PropagatorField *> &fullSrc,
+                       const unsigned int first, const unsigned int n);
+    void exportSolutions(std::vector<PropagatorField *> &prop, 
+                         std::vector<PropagatorField *> &propPhysical,
+                         std::vector<FermionField> &sol, FermionField &tmp,
+                         const unsigned int first, const unsigned int n);
 private:
-    unsigned int Ls_;
+    unsigned int Ls_, batchSize_;
     Solver       *solver_{nullptr};
 };
 
@@ -161,43 +173,44 @@ void TGaugeProp<FImpl>::setup(void)
                           + env().getObjectType(par().source)
                           + ")", env().getObjectAddress(par().source))
     }
+    // the sources are solved by batches
+    batchSize_ = ((par().batchSize == 0) or (par().batchSize > sourceSize)) ? 
+                 sourceSize : par().batchSize;
     envTmpLat(FermionField, "tmp");
     if (Ls_ > 1)
     {
-        envTmp(std::vector<FermionField>, "source", Ls_, sourceSize,
+        envTmp(std::vector<FermionField>, "source", Ls_, batchSize_,
                envGetGrid(FermionField, Ls_));
-        envTmp(std::vector<FermionField>, "sol", Ls_, sourceSize,
+        envTmp(std::vector<FermionField>, "sol", Ls_, batchSize_,
                envGetGrid(FermionField, Ls_));
     }
     else
     {
-        envTmp(std::vector<FermionField>, "source", 1, sourceSize,
+        envTmp(std::vector<FermionField>, "source", 1, batchSize_,
                envGetGrid(FermionField));
-        envTmp(std::vector<FermionField>, "sol", 1, sourceSize,
+        envTmp(std::vector<FermionField>, "sol", 1, batchSize_,
                envGetGrid(FermionField));
     }
 }
 
 // execution ///////////////////////////////////////////////////////////////////
 template <typename FImpl>
-void TGaugeProp<FImpl>::solvePropagator(std::vector<PropagatorField *> &prop, 
-                                        std::vector<PropagatorField *> &propPhysical,
-                                        const std::vector<PropagatorField *> &fullSrc)
+void TGaugeProp<FImpl>::importSources(std::vector<FermionField> &source, 
+                                      FermionField &tmp,
+                                      const std::vector<PropagatorField *> &fullSrc,
+                                      const unsigned int first, 
+                                      const unsigned int n)
 {
-    auto &solver  = envGet(Solver, par().solver);
-    auto &mat     = solver.getFMat();
-    unsigned int j = 0;
-    
-    envGetTmp(std::vector<FermionField>, source);
-    envGetTmp(std::vector<FermionField>, sol);
-    envGetTmp(FermionField, tmp);
+    auto         &solver = envGet(Solver, par().solver);
+    auto         &mat    = solver.getFMat();
+    unsigned int nsc     = Ns*FImpl::Dimension;
 
-    LOG(Message) << "Import sources" << std::endl;
-    startTimer("Import sources");
-    for (unsigned int i = 0; i < fullSrc.size(); ++i)
-    for (unsigned int s = 0; s < Ns; ++s)
-    for (unsigned int c = 0; c < FImpl::Dimension; ++c)
+    for (unsigned int j = 0; j < n; ++j)
     {
+        unsigned int i = (first + j)/nsc;
+        unsigned int s = ((first + j)%nsc)/FImpl::Dimension;
+        unsigned int c = (first + j)%FImpl::Dimension;
+
         // 4D sources
         if (!env().isObject5d(par().source))
         {
@@ -214,33 +227,29 @@ void TGaugeProp<FImpl>::solvePropagator(std::vector<PropagatorField *> &prop,
         // 5D sources
         else
         {
-            if (Ls_ != env().getObjectLs(par().source))
-            {
-                HADRONS_ERROR(Size, "Ls mismatch between quark action and source");
-            }
-            else
-            {
-                PropToFerm<FImpl>(source[j], *(fullSrc[i]), s, c);
-            }
+            PropToFerm<FImpl>(source[j], *(fullSrc[i]), s, c);
         }
-        j++;
     }
-    stopTimer("Import sources");
-    LOG(Message) << "Solve" << std::endl;
-    startTimer("Solver");
-    for (auto &s: sol)
-    {
-        s = Zero();
-    }
-    solver(sol, source);
-    stopTimer("Solver");
-    LOG(Message) << "Export solutions" << std::endl;
-    startTimer("Export solutions");
-    j = 0;
-    for (unsigned int i = 0; i < fullSrc.size(); ++i)
-    for (unsigned int s = 0; s < Ns; ++s)
-    for (unsigned int c = 0; c < FImpl::Dimension; ++c)
+}
+
+template <typename FImpl>
+void TGaugeProp<FImpl>::exportSolutions(std::vector<PropagatorField *> &prop, 
+                                        std::vector<PropagatorField *> &propPhysical,
+                                        std::vector<FermionField> &sol, 
+                                        FermionField &tmp,
+                                        const unsigned int first, 
+                                        const unsigned int n)
+{
+    auto         &solver = envGet(Solver, par().solver);
+    auto         &mat    = solver.getFMat();
+    unsigned int nsc     = Ns*FImpl::Dimension;
+
+    for (unsigned int j = 0; j < n; ++j)
     {
+        unsigned int i = (first + j)/nsc;
+        unsigned int s = ((first + j)%nsc)/FImpl::Dimension;
+        unsigned int c = (first + j)%FImpl::Dimension;
+
         FermToProp<FImpl>(*(prop[i]), sol[j], s, c);
         // create 4D propagators from 5D one if necessary
         if (Ls_ > 1)
@@ -248,9 +257,80 @@ void TGaugeProp<FImpl>::solvePropagator(std::vector<PropagatorField *> &prop,
             mat.ExportPhysicalFermionSolution(sol[j], tmp);
             FermToProp<FImpl>(*(propPhysical[i]), tmp, s, c);
         }
-        j++;
     }
-    stopTimer("Export solutions");
+}
+
+template <typename FImpl>
+void TGaugeProp<FImpl>::solvePropagator(std::vector<PropagatorField *> &prop, 
+                                        std::vector<PropagatorField *> &propPhysical,
+                                        const std::vector<PropagatorField *> &fullSrc)
+{
+    auto         &solver = envGet(Solver, par().solver);
+    unsigned int total   = fullSrc.size()*Ns*FImpl::Dimension;
+    unsigned int nBatch  = (total + batchSize_ - 1)/batchSize_;
+    
+    envGetTmp(std::vector<FermionField>, source);
+    envGetTmp(std::vector<FermionField>, sol);
+    envGetTmp(FermionField, tmp);
+
+    if (env().isObject5d(par().source) and (Ls_ != env().getObjectLs(par().source)))
+    {
+        HADRONS_ERROR(Size, "Ls mismatch between quark action and source");
+    }
+    if (nBatch > 1)
+    {
+        LOG(Message) << "Solving " << total << " sources in " << nBatch 
+                     << " batches of " << batchSize_ << std::endl;
+    }
+    for (unsigned int b = 0; b < nBatch; ++b)
+    {
+        unsigned int first = b*batchSize_;
+        unsigned int n     = std::min(batchSize_, total - first);
+
+        LOG(Message) << "Import sources" << std::endl;
+        startTimer("Import sources");
+        importSources(source, tmp, fullSrc, first, n);
+        stopTimer("Import sources");
+        if (nBatch > 1)
+        {
+            LOG(Message) << "Solve batch " << b + 1 << "/" << nBatch << std::endl;
+        }
+        else
+        {
+            LOG(Message) << "Solve" << std::endl;
+        }
+        startTimer("Solver");
+        for (auto &s: sol)
+        {
+            s = Zero();
+        }
+        if (n == batchSize_)
+        {
+            solver(sol, source);
+        }
+        else
+        {
+            // partial last batch
+            std::vector<FermionField> solPart, sourcePart;
+
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                solPart.push_back(std::move(sol[j]));
+                sourcePart.push_back(std::move(source[j]));
+            }
+            solver(solPart, sourcePart);
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                sol[j]    = std::move(solPart[j]);
+                source[j] = std::move(sourcePart[j]);
+            }
+        }
+        stopTimer("Solver");
+        LOG(Message) << "Export solutions" << std::endl;
+        startTimer("Export solutions");
+        exportSolutions(prop, propPhysical, sol, tmp, first, n);
+        stopTimer("Export solutions");
+    }
 }
 
 template <typename FImpl>
@@ -43,9 +43,14 @@ BEGIN_MODULE_NAMESPACE(MGauge)
 class StochasticQedLPar: Serializable
 {
 public:
+    StochasticQedLPar(void): nField{1} {};
+public:
+    // nField: number of fields generated together, if larger than 1 the output
+    // is a vector of fields
     GRID_SERIALIZABLE_CLASS_MEMBERS(StochasticQedLPar,
                                     QedGauge, gauge,
-                                    std::string, improvement);
+                                    std::string, improvement,
+                                    unsigned int, nField);
 };
 
 template <typename VType>
@@ -105,16 +110,25 @@ void TStochasticQedL<VType>::setup(void)
 {
     weightDone_ = env().hasCreatedObject("_" + getName() + "_weight");
     envCacheLat(ScalarField, "_" + getName() + "_weight");
-    envCreateLat(GaugeField, getName());
-    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField));
+    envCacheLat(ScalarField, "_" + getName() + "_sqrtWeight");
+    if (par().nField > 1)
+    {
+        envCreate(std::vector<GaugeField>, getName(), 1, par().nField, 
+                  envGetGrid(GaugeField));
+    }
+    else
+    {
+        envCreateLat(GaugeField, getName());
+    }
+    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField), &envGetFft(GaugeField));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
 template <typename VType>
 void TStochasticQedL<VType>::execute(void)
 {
-    auto &a = envGet(GaugeField, getName());
     auto &w = envGet(ScalarField, "_" + getName() + "_weight");
+    auto &sw = envGet(ScalarField, "_" + getName() + "_sqrtWeight");
     std::vector<double> improvement = strToVec<double>(par().improvement);
     envGetTmp(EmGen, gen);
     if (!weightDone_)
@@ -125,10 +139,20 @@ void TStochasticQedL<VType>::execute(void)
             LOG(Message) << "Improvement coefficients " << improvement << std::endl;
         }
         gen.makeWeightsQedL(w, improvement);
+        gen.makeSqrtWeight(sw, w);
     }
     LOG(Message) << "Generating stochastic EM potential (gauge: " << par().gauge << ")" << std::endl;
     auto tr = gen.getGaugeTranform(par().gauge);
-    gen(a, rng4d(), w, tr);
+    startTimer("Generation");
+    if (par().nField > 1)
+    {
+        gen.generate(envGet(std::vector<GaugeField>, getName()), rng4d(), sw, tr);
+    }
+    else
+    {
+        gen.generate(envGet(GaugeField, getName()), rng4d(), sw, tr);
+    }
+    stopTimer("Generation");
 }
 
 END_MODULE_NAMESPACE
@@ -41,8 +41,13 @@ BEGIN_MODULE_NAMESPACE(MGauge)
 class StochasticQedSubZmPar: Serializable
 {
 public:
+    StochasticQedSubZmPar(void): nField{1} {};
+public:
+    // nField: number of fields generated together, if larger than 1 the output
+    // is a vector of fields
     GRID_SERIALIZABLE_CLASS_MEMBERS(StochasticQedSubZmPar,
-                                    QedGauge, gauge);
+                                    QedGauge, gauge,
+                                    unsigned int, nField);
 };
 
 template <typename VType>
@@ -102,25 +107,44 @@ void TStochasticQedTL<VType>::setup(void)
 {
     weightDone_ = env().hasCreatedObject("_" + getName() + "_weight");
     envCacheLat(ScalarField, "_" + getName() + "_weight");
-    envCreateLat(GaugeField, getName());
-    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField));
+    envCacheLat(ScalarField, "_" + getName() + "_sqrtWeight");
+    if (par().nField > 1)
+    {
+        envCreate(std::vector<GaugeField>, getName(), 1, par().nField, 
+                  envGetGrid(GaugeField));
+    }
+    else
+    {
+        envCreateLat(GaugeField, getName());
+    }
+    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField), &envGetFft(GaugeField));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
 template <typename VType>
 void TStochasticQedTL<VType>::execute(void)
 {
-    auto &a = envGet(GaugeField, getName());
     auto &w = envGet(ScalarField, "_" + getName() + "_weight");
+    auto &sw = envGet(ScalarField, "_" + getName() + "_sqrtWeight");
     envGetTmp(EmGen, gen);
     if (!weightDone_)
     {
         LOG(Message) << "Caching stochastic QED_TL EM potential weights" << std::endl;
         gen.makeWeightsQedTL(w);
+        gen.makeSqrtWeight(sw, w);
     }
     LOG(Message) << "Generating stochastic EM potential (gauge: " << par().gauge << ")" << std::endl;
     auto tr = gen.getGaugeTranform(par().gauge);
-    gen(a, rng4d(), w, tr);
+    startTimer("Generation");
+    if (par().nField > 1)
+    {
+        gen.generate(envGet(std::vector<GaugeField>, getName()), rng4d(), sw, tr);
+    }
+    else
+    {
+        gen.generate(envGet(GaugeField, getName()), rng4d(), sw, tr);
+    }
+    stopTimer("Generation");
 }
 
 END_MODULE_NAMESPACE
@@ -41,9 +41,14 @@ BEGIN_MODULE_NAMESPACE(MGauge)
 class StochasticQedZetaPar: Serializable
 {
 public:
+    StochasticQedZetaPar(void): nField{1} {};
+public:
+    // nField: number of fields generated together, if larger than 1 the output
+    // is a vector of fields
     GRID_SERIALIZABLE_CLASS_MEMBERS(StochasticQedZetaPar,
                                     QedGauge, gauge,
-                                    double,   zeta);
+                                    double,   zeta,
+                                    unsigned int, nField);
 };
 
 template <typename VType>
@@ -103,26 +108,45 @@ void TStochasticQedZeta<VType>::setup(void)
 {
     weightDone_ = env().hasCreatedObject("_" + getName() + "_weight");
     envCacheLat(ScalarField, "_" + getName() + "_weight");
-    envCreateLat(GaugeField, getName());
-    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField));
+    envCacheLat(ScalarField, "_" + getName() + "_sqrtWeight");
+    if (par().nField > 1)
+    {
+        envCreate(std::vector<GaugeField>, getName(), 1, par().nField, 
+                  envGetGrid(GaugeField));
+    }
+    else
+    {
+        envCreateLat(GaugeField, getName());
+    }
+    envTmp(EmGen, "gen", 1, envGetGrid(GaugeField), &envGetFft(GaugeField));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
 template <typename VType>
 void TStochasticQedZeta<VType>::execute(void)
 {
-    auto &a = envGet(GaugeField, getName());
     auto &w = envGet(ScalarField, "_" + getName() + "_weight");
+    auto &sw = envGet(ScalarField, "_" + getName() + "_sqrtWeight");
     envGetTmp(EmGen, gen);
     if (!weightDone_)
     {
         LOG(Message) << "Caching stochastic QED_Zeta EM potential weights  (";
         std::cout << "zeta = " << par().zeta << ")" << std::endl;
         gen.makeWeightsQedZeta(w, par().zeta);
+        gen.makeSqrtWeight(sw, w);
     }
     LOG(Message) << "Generating stochastic EM potential (gauge: " << par().gauge << ")" << std::endl;
     auto tr = gen.getGaugeTranform(par().gauge);
-    gen(a, rng4d(), w, tr);
+    startTimer("Generation");
+    if (par().nField > 1)
+    {
+        gen.generate(envGet(std::vector<GaugeField>, getName()), rng4d(), sw, tr);
+    }
+    else
+    {
+        gen.generate(envGet(GaugeField, getName()), rng4d(), sw, tr);
+    }
+    stopTimer("Generation");
 }
 
 END_MODULE_NAMESPACE
@@ -29,24 +29,45 @@
 
 #include <Hadrons/Global.hpp>
 
+// cache size targeted by the site tiles of the projection kernel (in bytes)
+#ifndef HADRONS_BATCH_DEFLATION_CACHE
+#define HADRONS_BATCH_DEFLATION_CACHE (1024*1024)
+#endif
+
 BEGIN_HADRONS_NAMESPACE
 
 namespace BatchDeflationUtils
 {
+    // performance counters, accumulated over calls
+    struct ProjStat
+    {
+        double overlapTime{0.}, guessTime{0.}, bytes{0.}, flops{0.};
+    };
+
+    // out[j] += sum_i <evec[i]|in[j]>/eval[i] evec[i] for i in [ei, ef) and 
+    // j in [si, sf)
     template <typename Field>
     void projAccumulate(const std::vector<Field> &in, std::vector<Field> &out,
                         const std::vector<Field>& evec,
                         const std::vector<RealD>& eval,
                         const unsigned int ei, const unsigned int ef,
-                        const unsigned int si, const unsigned int sf);
+                        const unsigned int si, const unsigned int sf,
+                        ProjStat *stat = nullptr);
+    // same with one innerProduct and axpy per pair (reference implementation)
+    template <typename Field>
+    void projAccumulateReference(const std::vector<Field> &in, std::vector<Field> &out,
+                                 const std::vector<Field>& evec,
+                                 const std::vector<RealD>& eval,
+                                 const unsigned int ei, const unsigned int ef,
+                                 const unsigned int si, const unsigned int sf);
 };
 
 template <typename Field>
-void BatchDeflationUtils::projAccumulate(const std::vector<Field> &in, std::vector<Field> &out,
-                                         const std::vector<Field>& evec,
-                                         const std::vector<RealD>& eval,
-                                         const unsigned int ei, const unsigned int ef,
-                                         const unsigned int si, const unsigned int sf)
+void BatchDeflationUtils::projAccumulateReference(const std::vector<Field> &in, std::vector<Field> &out,
+                                                  const std::vector<Field>& evec,
+                                                  const std::vector<RealD>& eval,
+                                                  const unsigned int ei, const unsigned int ef,
+                                                  const unsigned int si, const unsigned int sf)
 {
     GridBase *g       = in[0].Grid();
     double   lVol     = g->lSites();
@@ -69,6 +90,176 @@ void BatchDeflationUtils::projAccumulate(const std::vector<Field> &in, std::vect
                  << " GB | " << 5.*nIt*lSizeGB/t*1.0e6 << " GB/s" << std::endl;
 }
 
+// The projection is done in two cache-tiled passes over the local sites. The
+// first one computes the whole overlap matrix <evec[i]|in[j]>: each thread 
+// accumulates the local sums of a range of sites tile by tile, so that the
+// source tiles stay in cache while the eigenvectors are streamed, and all the
+// overlaps are reduced by a single global sum. As in Grid's innerProduct, the
+// sums are accumulated in double precision for single precision fields. The
+// second pass forms the guesses, the guess tiles staying in cache while the
+// eigenvectors are streamed again. On GPU builds the reference implementation
+// is used.
+template <typename Field>
+void BatchDeflationUtils::projAccumulate(const std::vector<Field> &in, std::vector<Field> &out,
+                                         const std::vector<Field>& evec,
+                                         const std::vector<RealD>& eval,
+                                         const unsigned int ei, const unsigned int ef,
+                                         const unsigned int si, const unsigned int sf,
+                                         ProjStat *stat)
+{
+#if defined(GRID_CUDA) || defined(GRID_HIP) || defined(GRID_SYCL)
+    double t = -usecond();
+
+    projAccumulateReference(in, out, evec, eval, ei, ef, si, sf);
+    t += usecond();
+    if (stat)
+    {
+        double lSize = in[0].Grid()->lSites()*sizeof(typename Field::scalar_object);
+        double nCplx = sizeof(typename Field::scalar_object)/sizeof(typename Field::scalar_type);
+
+        stat->guessTime += t;
+        stat->bytes     += 5.*(ef - ei)*(sf - si)*lSize;
+        stat->flops     += 16.*(ef - ei)*(sf - si)*in[0].Grid()->lSites()*nCplx;
+    }
+#else
+    typedef typename Field::vector_object                        vobj;
+    typedef typename vobj::scalar_type                           scalar;
+    typedef decltype(in[0].View(CpuRead))                        View;
+    typedef decltype(TensorRemove(innerProductD(vobj(), vobj()))) InnerV;
+
+    GridBase           *g       = in[0].Grid();
+    const unsigned int ne       = ef - ei, ns = sf - si;
+    const unsigned int nOSite   = g->oSites();
+    const unsigned int tileSize = std::max(static_cast<size_t>(1), 
+                                           HADRONS_BATCH_DEFLATION_CACHE/(ns*sizeof(vobj)));
+    const unsigned int nTile    = (nOSite + tileSize - 1)/tileSize;
+    const unsigned int nChunk   = std::min(static_cast<unsigned int>(GridThread::GetThreads()), nTile);
+    const unsigned int eBlock   = std::max(static_cast<size_t>(1),
+                                           HADRONS_BATCH_DEFLATION_CACHE/(ns*sizeof(InnerV)));
+    double             lVol     = g->lSites();
+    double             siteSize = sizeof(typename Field::scalar_object);
+    double             nCplx    = siteSize/sizeof(scalar);
+    double             lSizeGB  = lVol*siteSize/1024./1024./1024.;
+    double             t1 = 0., t2 = 0., b1, b2, f;
+    std::vector<View>     evecV, inV, outV;
+    std::vector<ComplexD> overlap(ne*ns, 0.);
+    std::vector<scalar>   coef(ne*ns);
+
+    for (unsigned int i = ei; i < ef; ++i)
+    {
+        evecV.push_back(evec[i].View(CpuRead));
+    }
+    for (unsigned int j = si; j < sf; ++j)
+    {
+        inV.push_back(in[j].View(CpuRead));
+    }
+
+    // pass 1: overlap matrix
+    t1 -= usecond();
+    for (unsigned int eb = 0; eb < ne; eb += eBlock)
+    {
+        unsigned int                       nbe = std::min(eBlock, ne - eb);
+        std::vector<std::vector<ComplexD>> part(nChunk);
+
+        thread_for(c, nChunk,
+        {
+            std::vector<InnerV> acc(nbe*ns);
+
+            for (auto &a: acc)
+            {
+                zeroit(a);
+            }
+            for (unsigned int tl = c*nTile/nChunk; tl < (c + 1)*nTile/nChunk; ++tl)
+            {
+                unsigned int sEnd = std::min((tl + 1)*tileSize, nOSite);
+
+                for (unsigned int i = 0; i < nbe; ++i)
+                for (unsigned int ss = tl*tileSize; ss < sEnd; ++ss)
+                {
+                    const vobj &e = evecV[eb + i][ss];
+
+                    for (unsigned int j = 0; j < ns; ++j)
+                    {
+                        acc[i*ns + j] += TensorRemove(innerProductD(e, inV[j][ss]));
+                    }
+                }
+            }
+            part[c].resize(nbe*ns);
+            for (unsigned int k = 0; k < nbe*ns; ++k)
+            {
+                part[c][k] = Reduce(acc[k]);
+            }
+        });
+        for (auto &p: part)
+        for (unsigned int k = 0; k < nbe*ns; ++k)
+        {
+            overlap[eb*ns + k] += p[k];
+        }
+    }
+    g->GlobalSumVector(overlap.data(), ne*ns);
+    t1 += usecond();
+    for (auto &v: inV)
+    {
+        v.ViewClose();
+    }
+
+    // pass 2: guesses
+    for (unsigned int i = 0; i < ne; ++i)
+    for (unsigned int j = 0; j < ns; ++j)
+    {
+        coef[i*ns + j] = overlap[i*ns + j]/eval[ei + i];
+    }
+    for (unsigned int j = si; j < sf; ++j)
+    {
+        outV.push_back(out[j].View(CpuWrite));
+    }
+    t2 -= usecond();
+    thread_for(tl, nTile,
+    {
+        unsigned int sEnd = std::min(static_cast<unsigned int>((tl + 1)*tileSize), nOSite);
+
+        for (unsigned int i = 0; i < ne; ++i)
+        for (unsigned int ss = tl*tileSize; ss < sEnd; ++ss)
+        {
+            const vobj &e = evecV[i][ss];
+
+            for (unsigned int j = 0; j < ns; ++j)
+            {
+                outV[j][ss] = outV[j][ss] + coef[i*ns + j]*e;
+            }
+        }
+    });
+    t2 += usecond();
+    for (auto &v: outV)
+    {
+        v.ViewClose();
+    }
+    for (auto &v: evecV)
+    {
+        v.ViewClose();
+    }
+
+    // performance (STREAM convention): overlap reads the eigenvectors once and 
+    // the sources once per eigenvector block, guess reads the eigenvectors 
+    // once and reads and writes the guesses once
+    b1 = (ne + ns*((ne + eBlock - 1)/eBlock))*lSizeGB;
+    b2 = (ne + 2.*ns)*lSizeGB;
+    f  = 8.*ne*ns*lVol*nCplx;
+    LOG(Debug) << "projAccumulate: overlap " << t1 << " us | " << b1 
+               << " GB | " << b1/t1*1.0e6 << " GB/s | " << f/t1*1.0e-3 
+               << " GFlop/s" << std::endl;
+    LOG(Debug) << "projAccumulate: guess   " << t2 << " us | " << b2 
+               << " GB | " << b2/t2*1.0e6 << " GB/s | " << f/t2*1.0e-3 
+               << " GFlop/s" << std::endl;
+    if (stat)
+    {
+        stat->overlapTime += t1;
+        stat->guessTime   += t2;
+        stat->bytes       += (b1 + b2)*1024.*1024.*1024.;
+        stat->flops       += 2.*f;
+    }
+#endif
+}
 
 END_HADRONS_NAMESPACE
 
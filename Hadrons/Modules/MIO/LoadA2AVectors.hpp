@@ -60,6 +60,7 @@ public:
     // dependency relation
     virtual std::vector<std::string> getInput(void);
     virtual std::vector<std::string> getOutput(void);
+    virtual std::vector<std::string> getInputFiles(const unsigned int traj);
     // setup
     virtual void setup(void);
     // execution
@@ -94,6 +95,15 @@ std::vector<std::string> TLoadA2AVectors<FImpl>::getOutput(void)
     return out;
 }
 
+template <typename FImpl>
+std::vector<std::string> TLoadA2AVectors<FImpl>::getInputFiles(const unsigned int traj)
+{
+    std::string t = "." + std::to_string(traj);
+    std::vector<std::string> in = {par().filestem + t + (par().multiFile ? "" : ".bin")};
+    
+    return in;
+}
+
 // setup ///////////////////////////////////////////////////////////////////////
 template <typename FImpl>
 void TLoadA2AVectors<FImpl>::setup(void)
@@ -72,6 +72,7 @@ public:
     // dependency relation
     virtual std::vector<std::string> getInput(void);
     virtual std::vector<std::string> getOutput(void);
+    virtual std::vector<std::string> getInputFiles(const unsigned int traj);
     // setup
     virtual void setup(void);
     // execution
@@ -115,6 +116,15 @@ std::vector<std::string> TLoadEigenPack<Pack, GImpl>::getOutput(void)
     return out;
 }
 
+template <typename Pack, typename GImpl>
+std::vector<std::string> TLoadEigenPack<Pack, GImpl>::getInputFiles(const unsigned int traj)
+{
+    std::string t = "." + std::to_string(traj);
+    std::vector<std::string> in = {par().filestem + t + (par().multiFile ? "" : ".bin")};
+    
+    return in;
+}
+
 // setup ///////////////////////////////////////////////////////////////////////
 template <typename Pack, typename GImpl>
 void TLoadEigenPack<Pack, GImpl>::setup(void)
@@ -32,6 +32,7 @@ public:
     // dependency relation
     virtual std::vector<std::string> getInput(void);
     virtual std::vector<std::string> getOutput(void);
+    virtual std::vector<std::string> getInputFiles(const unsigned int traj);
     // setup
     virtual void setup(void);
     // execution
@@ -66,6 +67,14 @@ std::vector<std::string> TLoadIldg<GImpl>::getOutput(void)
     return out;
 }
 
+template <typename GImpl>
+std::vector<std::string> TLoadIldg<GImpl>::getInputFiles(const unsigned int traj)
+{
+    std::vector<std::string> in = {par().file + "." + std::to_string(traj)};
+    
+    return in;
+}
+
 // setup ///////////////////////////////////////////////////////////////////////
 template <typename GImpl>
 void TLoadIldg<GImpl>::setup(void)
@@ -63,6 +63,7 @@ public:
     // dependency relation
     virtual std::vector<std::string> getInput(void);
     virtual std::vector<std::string> getOutput(void);
+    virtual std::vector<std::string> getInputFiles(const unsigned int traj);
     // setup
     virtual void setup(void);
     // execution
@@ -97,6 +98,14 @@ std::vector<std::string> TLoadOpenQcd<GImpl>::getOutput(void)
     return out;
 }
 
+template <typename GImpl>
+std::vector<std::string> TLoadOpenQcd<GImpl>::getInputFiles(const unsigned int traj)
+{
+    std::vector<std::string> in = {par().file + "n" + std::to_string(traj)};
+    
+    return in;
+}
+
 // setup ///////////////////////////////////////////////////////////////////////
 template <typename GImpl>
 void TLoadOpenQcd<GImpl>::setup(void)
@@ -125,9 +125,8 @@ void TBilinear<FImpl>::setup(void)
     envTmpLat(PropagatorField, "qIn_phased");
     envTmpLat(PropagatorField, "qOut_phased");
     envTmpLat(PropagatorField, "lret");
-    envTmpLat(ComplexField, "pDotXIn");
-    envTmpLat(ComplexField, "pDotXOut");
-    envTmpLat(ComplexField, "xMu");
+    envCachePhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pIn));
+    envCachePhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pOut));
 
     envCreate(HadronsSerializable, getName(), 1, 0);
 }
@@ -171,16 +170,9 @@ void TBilinear<FImpl>::execute(void)
     envGetTmp(PropagatorField, qIn_phased);
     envGetTmp(PropagatorField, qOut_phased);
     envGetTmp(PropagatorField, lret);
-    envGetTmp(ComplexField, pDotXIn);
-    envGetTmp(ComplexField, pDotXOut);
-    envGetTmp(ComplexField, xMu);
 
-    // momentum on legs
-    std::vector<Real>           pIn  = strToVec<Real>(par().pIn),
-	                        pOut = strToVec<Real>(par().pOut);
     Coordinate                  latt_size = GridDefaultLatt();
     Gamma                       g5(Gamma::Algebra::Gamma5);
-    Complex                     Ci(0.0,1.0);
     std::vector<Result>         result;
     Result                      r;
 
@@ -189,18 +181,22 @@ void TBilinear<FImpl>::execute(void)
         volume *= latt_size[mu];
     }
 
-    NPRUtils<FImpl>::dot(pDotXIn,pIn);
-    qIn_phased  = qIn  * exp(-Ci * pDotXIn);
-    NPRUtils<FImpl>::dot(pDotXOut,pOut);
-    qOut_phased = qOut * exp(-Ci * pDotXOut);
+    // momentum on legs
+    qIn_phased  = qIn  * envGetPhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pIn));
+    qOut_phased = qOut * envGetPhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pOut));
+
+    // the colour-contracted outer product of the legs is summed over the 
+    // volume once, the gamma structures are then applied to the sum
+    std::vector<SpinColourMatrix> t;
 
+    lret = g5 * adj(qOut_phased) * g5;
+    NPRUtils<FImpl>::bilinearTensor(t, lret, qIn_phased);
     r.info.pIn  = par().pIn;
     r.info.pOut = par().pOut;
     for (auto &G: Gamma::gall)
     {
         r.info.gamma = G.g;
-        lret = g5 * adj(qOut_phased) * g5 * G * qIn_phased;
-        r.corr.push_back( (1.0 / volume) * sum_large(lret) );
+        r.corr.push_back( (1.0 / volume) * NPRUtils<FImpl>::contractGamma(t, G) );
         result.push_back(r);
         r.corr.erase(r.corr.begin());
     }
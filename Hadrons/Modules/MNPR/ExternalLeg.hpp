@@ -104,8 +104,7 @@ void TExternalLeg<FImpl>::setup(void)
     LOG(Message) << "Running setup for ExternalLeg" << std::endl;
 
     envTmpLat(PropagatorField, "qIn_phased");
-    envTmpLat(ComplexField, "pDotXIn");
-    envTmpLat(ComplexField, "xMu");
+    envCachePhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pIn));
 
     envCreate(HadronsSerializable, getName(), 1, 0);
 }
@@ -144,12 +143,8 @@ void TExternalLeg<FImpl>::execute(void)
                  << std::endl;
     auto                &qIn    = envGet(PropagatorField, par().qIn);
     envGetTmp(PropagatorField, qIn_phased);
-    envGetTmp(ComplexField, pDotXIn);
-    envGetTmp(ComplexField, xMu);
-    std::vector<Real>   pIn  = strToVec<Real>(par().pIn);
     Coordinate          latt_size = GridDefaultLatt();
     Gamma               g5(Gamma::Algebra::Gamma5);
-    Complex             Ci(0.0,1.0);
     Result              r;
 
 
@@ -158,8 +153,7 @@ void TExternalLeg<FImpl>::execute(void)
         volume *= latt_size[mu];
     }
 
-    NPRUtils<FImpl>::dot(pDotXIn,pIn);
-    qIn_phased = qIn * exp(-Ci * pDotXIn); // phase corrections
+    qIn_phased = qIn * envGetPhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pIn)); // phase corrections
 
     r.info.pIn  = par().pIn;
     r.corr.push_back( (1.0 / volume) * sum(qIn_phased) );
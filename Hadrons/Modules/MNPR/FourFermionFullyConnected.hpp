@@ -126,7 +126,6 @@ void TFourFermionFullyConnected<FImpl>::setup()
 
     envTmpLat(PropagatorField, "quark_bilinear");
     envTmpLat(PropagatorField, "lepton_bilinear");
-    envTmpLat(PropagatorField, "tmp_bilinear");
     envTmpLat(ComplexField, "bilinear_phase");
 
     envCreate(HadronsSerializable, getName(), 1, 0);
@@ -147,7 +146,6 @@ void TFourFermionFullyConnected<FImpl>::execute()
 
     envGetTmp(PropagatorField, quark_bilinear);
     envGetTmp(PropagatorField, lepton_bilinear);
-    envGetTmp(PropagatorField, tmp_bilinear);
 
 
     std::vector<Result>         result;
@@ -189,7 +187,7 @@ void TFourFermionFullyConnected<FImpl>::execute()
         SpinColourSpinColourMatrix lret;
         quark_bilinear = bilinear_phase * (g5 * adj(qOut) * g5 * gamma_A * qIn);
         lepton_bilinear = bilinear_phase * (g5 * adj(lOut) * g5 * gamma_B * lIn);
-        lret = NPRUtils<FImpl>::tensorProdSum(tmp_bilinear, quark_bilinear, lepton_bilinear);
+        lret = NPRUtils<FImpl>::tensorProdSum(quark_bilinear, lepton_bilinear);
 
         r.corr.push_back( (1.0 / volume) * lret );
         result.push_back(r);
@@ -125,7 +125,6 @@ void TFourQuarkFullyConnected<FImpl>::setup()
 
     envTmpLat(PropagatorField, "bilinear");
     envTmpLat(PropagatorField, "bilinear_tmp");
-    envTmpLat(PropagatorField, "bilinear_sum");
     envTmpLat(ComplexField, "bilinear_phase");
 
     envCreate(HadronsSerializable, getName(), 1, 0);
@@ -143,7 +142,6 @@ void TFourQuarkFullyConnected<FImpl>::execute()
 
     envGetTmp(PropagatorField, bilinear);
     envGetTmp(PropagatorField, bilinear_tmp);
-    envGetTmp(PropagatorField, bilinear_sum);
 
 
     std::vector<Result>         result;
@@ -170,6 +168,9 @@ void TFourQuarkFullyConnected<FImpl>::execute()
     r.info.pIn  = par().pIn;
     r.info.pOut = par().pOut;
 
+    bool           haveBilinear = false;
+    Gamma::Algebra bilinearGamma;
+
     auto compute_diagrams = [&](Gamma gamma_A, Gamma gamma_B, bool print = true) {
 
         r.info.gammaA = gamma_A.g;
@@ -181,16 +182,21 @@ void TFourQuarkFullyConnected<FImpl>::execute()
                 << std::endl;
         }
 
-        // Fully connected diagram
-        bilinear = bilinear_phase * (g5 * adj(qOut) * g5 * gamma_A * qIn);
+        // Fully connected diagram, the first bilinear is kept while gamma_A
+        // does not change
+        if (!haveBilinear or (bilinearGamma != gamma_A.g)) {
+            bilinear      = bilinear_phase * (g5 * adj(qOut) * g5 * gamma_A * qIn);
+            bilinearGamma = gamma_A.g;
+            haveBilinear  = true;
+        }
 
         SpinColourSpinColourMatrix lret;
         if (gamma_A.g == gamma_B.g) {
-            lret = NPRUtils<FImpl>::tensorProdSum(bilinear_sum, bilinear, bilinear);
+            lret = NPRUtils<FImpl>::tensorProdSum(bilinear, bilinear);
         }
         else {
             bilinear_tmp = bilinear_phase * (g5 * adj(qOut) * g5 * gamma_B * qIn);
-            lret = NPRUtils<FImpl>::tensorProdSum(bilinear_sum, bilinear, bilinear_tmp);
+            lret = NPRUtils<FImpl>::tensorProdSum(bilinear, bilinear_tmp);
         }
         r.corr.push_back( (1.0 / volume) * lret );
         result.push_back(r);
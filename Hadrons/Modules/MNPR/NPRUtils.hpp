@@ -41,37 +41,159 @@ class NPRUtils
 {
 public:
     FERM_TYPE_ALIASES(FImpl,)
-    static SpinColourSpinColourMatrix tensorProdSum(PropagatorField &tsum, PropagatorField &a, PropagatorField &b);
+    typedef typename PropagatorField::vector_type SimdComplex;
+    // site-reduced engine: volume sum of a site kernel filling nOut complex 
+    // numbers, partial sums are kept per thread and reduced once at the end
+    template <typename Kernel>
+    static void siteReducedSum(std::vector<ComplexD> &res, const unsigned int nOut,
+                               GridBase *g, Kernel kernel);
+    static SpinColourSpinColourMatrix tensorProdSum(const PropagatorField &a, const PropagatorField &b);
+    // colour-contracted spin tensor t[Ns*r + r'] = sum_{x,c} a(x)_{.,(r,c)} b(x)_{(r',c),.}
+    // and its contraction with a spin structure G, which gives sum_x a(x)*G*b(x)
+    static void bilinearTensor(std::vector<SpinColourMatrix> &t, const PropagatorField &a,
+                               const PropagatorField &b);
+    template <typename GammaType>
+    static SpinColourMatrix contractGamma(const std::vector<SpinColourMatrix> &t, const GammaType &G);
     static void tensorSiteProd(SpinColourSpinColourMatrix &lret, SpinColourMatrixScalar &a, SpinColourMatrixScalar &b);
     // covariant derivative
     static void dslash(PropagatorField &in, const PropagatorField &out,
         const GaugeField &Umu);
     static void phase(ComplexField &bilinearPhase, std::vector<Real> pIn, std::vector<Real> pOut);
     static void dot(ComplexField &pDotX, std::vector<Real> p);
+    // momentum of the shared phase exp(-i p.x) correcting a leg
+    static std::vector<Real> legMomentum(const std::string p);
 
 };
 
+// Site-reduced volume sum
+template <typename FImpl>
+template <typename Kernel>
+void NPRUtils<FImpl>::siteReducedSum(std::vector<ComplexD> &res, const unsigned int nOut,
+                                     GridBase *g, Kernel kernel)
+{
+    const unsigned int                 nSite  = g->oSites();
+    const unsigned int                 nChunk = std::min(static_cast<unsigned int>(GridThread::GetThreads()), nSite);
+    std::vector<std::vector<ComplexD>> part(nChunk);
+
+    thread_for(c, nChunk,
+    {
+        std::vector<SimdComplex> acc(nOut);
+
+        for (auto &a: acc)
+        {
+            zeroit(a);
+        }
+        for (unsigned int ss = c*nSite/nChunk; ss < (c + 1)*nSite/nChunk; ++ss)
+        {
+            kernel(acc.data(), ss);
+        }
+        part[c].resize(nOut);
+        for (unsigned int k = 0; k < nOut; ++k)
+        {
+            part[c][k] = Reduce(acc[k]);
+        }
+    });
+    res.assign(nOut, 0.);
+    for (auto &p: part)
+    for (unsigned int k = 0; k < nOut; ++k)
+    {
+        res[k] += p[k];
+    }
+    g->GlobalSumVector(res.data(), nOut);
+}
+
 // Tensor product of two PropagatorFields (Lattice Spin Colour Matrices in many FImpls)
+// summed over the volume in a single pass
 template <typename FImpl>
-SpinColourSpinColourMatrix NPRUtils<FImpl>::tensorProdSum(PropagatorField &tsum, PropagatorField &a, PropagatorField &b)
+SpinColourSpinColourMatrix NPRUtils<FImpl>::tensorProdSum(const PropagatorField &a, const PropagatorField &b)
 {
+    constexpr unsigned int nsc = Ns*Ns*Nc*Nc;
     SpinColourSpinColourMatrix result;
+    std::vector<ComplexD>      res;
 
-    for(int si=0; si < Ns; ++si)
-	{
-        for(int sj=0; sj < Ns; ++sj)
-	    {
-            for (int ci=0; ci < Nc; ++ci)
-	        {
-                for (int cj=0; cj < Nc; ++cj)
-	            {
-                    tsum = peekColour(peekSpin(a, si, sj), ci, cj) * b;
-                    result()(si,sj)(ci,cj) = sum_large(tsum)();
-                }
+    autoView(av, a, CpuRead);
+    autoView(bv, b, CpuRead);
+    siteReducedSum(res, nsc*nsc, a.Grid(), [&](SimdComplex *acc, const unsigned int ss)
+    {
+        auto as = reinterpret_cast<const SimdComplex *>(&av[ss]);
+        auto bs = reinterpret_cast<const SimdComplex *>(&bv[ss]);
+
+        for (unsigned int i = 0; i < nsc; ++i)
+        for (unsigned int j = 0; j < nsc; ++j)
+        {
+            acc[i*nsc + j] += as[i]*bs[j];
+        }
+    });
+    std::copy(res.begin(), res.end(), reinterpret_cast<ComplexD *>(&result));
+
+    return result;
+}
+
+// Colour-contracted spin tensor, summed over the volume in a single pass
+template <typename FImpl>
+void NPRUtils<FImpl>::bilinearTensor(std::vector<SpinColourMatrix> &t, const PropagatorField &a,
+                                     const PropagatorField &b)
+{
+    constexpr unsigned int nsc = Ns*Ns*Nc*Nc;
+    std::vector<ComplexD>  res;
+
+    autoView(av, a, CpuRead);
+    autoView(bv, b, CpuRead);
+    siteReducedSum(res, Ns*Ns*nsc, a.Grid(), [&](SimdComplex *acc, const unsigned int ss)
+    {
+        auto as = reinterpret_cast<const SimdComplex *>(&av[ss]);
+        auto bs = reinterpret_cast<const SimdComplex *>(&bv[ss]);
+
+        for (unsigned int s = 0; s < Ns; ++s)
+        for (unsigned int r = 0; r < Ns; ++r)
+        for (unsigned int ca = 0; ca < Nc; ++ca)
+        for (unsigned int c = 0; c < Nc; ++c)
+        {
+            const SimdComplex x = as[((s*Ns + r)*Nc + ca)*Nc + c];
+
+            for (unsigned int rp = 0; rp < Ns; ++rp)
+            for (unsigned int sp = 0; sp < Ns; ++sp)
+            for (unsigned int cb = 0; cb < Nc; ++cb)
+            {
+                acc[(Ns*r + rp)*nsc + ((s*Ns + sp)*Nc + ca)*Nc + cb] 
+                    += x*bs[((rp*Ns + sp)*Nc + c)*Nc + cb];
             }
         }
+    });
+    t.resize(Ns*Ns);
+    for (unsigned int k = 0; k < Ns*Ns; ++k)
+    {
+        std::copy(res.begin() + k*nsc, res.begin() + (k + 1)*nsc, 
+                  reinterpret_cast<ComplexD *>(&t[k]));
     }
-    return result;
+}
+
+// Contraction of the spin tensor with a spin structure (Gamma or GammaL)
+template <typename FImpl>
+template <typename GammaType>
+SpinColourMatrix NPRUtils<FImpl>::contractGamma(const std::vector<SpinColourMatrix> &t, 
+                                                const GammaType &G)
+{
+    SpinMatrix       id = Zero(), gm;
+    SpinColourMatrix res = Zero();
+
+    for (unsigned int s = 0; s < Ns; ++s)
+    {
+        id()(s, s)() = 1.;
+    }
+    gm = G*id;
+    for (unsigned int r = 0; r < Ns; ++r)
+    for (unsigned int rp = 0; rp < Ns; ++rp)
+    {
+        ComplexD g = TensorRemove(gm()(r, rp));
+
+        if (g != 0.)
+        {
+            res += g*t[Ns*r + rp];
+        }
+    }
+
+    return res;
 }
 
 // Tensor product on a single site only
@@ -122,18 +244,27 @@ void NPRUtils<FImpl>::dslash(PropagatorField &out, const PropagatorField &in,
 template <typename FImpl>
 void NPRUtils<FImpl>::phase(ComplexField &bilinearPhase, std::vector<Real> pIn, std::vector<Real> pOut)
 {
-    bilinearPhase = Zero();
-    ComplexField coordinate(bilinearPhase.Grid());
-    Coordinate                  latt_size = GridDefaultLatt();
+    std::vector<Real> p(Nd);
+
     for (int mu = 0; mu < Nd; mu++)
     {
-        LatticeCoordinate(coordinate, mu);
-        coordinate = (2 * M_PI / latt_size[mu]) * coordinate;
+        p[mu] = pOut[mu] - pIn[mu];
+    }
+    PhaseCache<ComplexField>::build(bilinearPhase, p);
+}
+
+// exp(-i p \cdot x) = exp(i (-p) \cdot x)
+template <typename FImpl>
+std::vector<Real> NPRUtils<FImpl>::legMomentum(const std::string p)
+{
+    std::vector<Real> mp = strToVec<Real>(p);
 
-        bilinearPhase += coordinate * (pIn[mu] - pOut[mu]);
+    for (auto &m: mp)
+    {
+        m = -m;
     }
-    Complex Ci = Complex(0.0, 1.0);
-    bilinearPhase = exp(-Ci * bilinearPhase);
+
+    return mp;
 }
 
 
@@ -144,7 +144,7 @@ void TSubtractionOperators<FImpl>::setup(void)
     envTmpLat(PropagatorField, "bilinear");
 
     envTmpLat(ComplexField, "bilinear_phase");
-    envTmpLat(ComplexField, "pDotXOut");
+    envCachePhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pOut));
     envTmpLat(ComplexField, "coordinate");
 
     envTmpLat(PropagatorField, "tmp");
@@ -175,7 +175,6 @@ void TSubtractionOperators<FImpl>::execute(void)
     std::vector<Real> pOut = strToVec<Real>(par().pOut);
 
     envGetTmp(ComplexField, bilinear_phase);
-    envGetTmp(ComplexField, pDotXOut);
     envGetTmp(ComplexField, coordinate);
 
     Result result;
@@ -191,15 +190,13 @@ void TSubtractionOperators<FImpl>::execute(void)
     LOG(Message) << "Calculating phases" << std::endl;
 
     NPRUtils<FImpl>::phase(bilinear_phase,pIn,pOut);
-    NPRUtils<FImpl>::dot(pDotXOut,pOut);
 
     //// Compute Dslash for both propagators
     NPRUtils<FImpl>::dslash(Dslash_qIn, qIn, Umu);
     NPRUtils<FImpl>::dslash(Dslash_qOut, qOut, Umu);
 
     //// Compute spectator quark for 4-quark diagrams
-    Complex Ci = Complex(0.0, 1.0);
-    bilinear = qIn * exp(-Ci * pDotXOut);
+    bilinear = qIn * envGetPhase(ComplexField, NPRUtils<FImpl>::legMomentum(par().pOut));
     SpinColourMatrixScalar spectator = sum(bilinear);
 
     //// Compute results
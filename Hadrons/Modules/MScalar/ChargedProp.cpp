@@ -65,7 +65,6 @@ void TChargedProp::setup(void)
     propQName_ = getName() + "_Q";
     propSunName_ = getName() + "_Sun";
     propTadName_ = getName() + "_Tad";
-    fftName_   = getName() + "_fft";
 
     freeMomPropDone_ = env().hasCreatedObject(freeMomPropName_);
     GFSrcDone_       = env().hasCreatedObject(GFSrcName_);
@@ -86,7 +85,6 @@ void TChargedProp::setup(void)
     envTmpLat(ScalarField, "buf");
     envTmpLat(ScalarField, "result");
     envTmpLat(ScalarField, "Amu");
-    envCache(FFT, fftName_, 1, env().getGrid());
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -107,7 +105,7 @@ void TChargedProp::execute(void)
 	auto   &propTad = envGet(ScalarField, propTadName_);
     auto   &GFSrc   = envGet(ScalarField, GFSrcName_);
     auto   &G       = envGet(ScalarField, freeMomPropName_);
-    auto   &fft     = envGet(FFT, fftName_);
+    auto   &fft     = env().getFft(env().getGrid());
     double q        = par().charge;
     envGetTmp(ScalarField, buf);
 
@@ -197,7 +195,7 @@ void TChargedProp::makeCaches(void)
     auto &freeMomProp = envGet(ScalarField, freeMomPropName_);
     auto &GFSrc       = envGet(ScalarField, GFSrcName_);
 	auto &prop0		  = envGet(ScalarField, prop0Name_);
-    auto &fft         = envGet(FFT, fftName_);
+    auto &fft         = env().getFft(env().getGrid());
 
     if (!freeMomPropDone_)
     {
@@ -97,7 +97,7 @@ private:
     bool                       freeMomPropDone_, GFSrcDone_, prop0Done_,
                                phasesDone_;
     std::string                freeMomPropName_, GFSrcName_, prop0Name_,
-                               propQName_, propSunName_, propTadName_, fftName_;
+                               propQName_, propSunName_, propTadName_;
     std::vector<std::string>   phaseName_;
     std::vector<ScalarField *> phase_;
 };
@@ -131,7 +131,7 @@ void TStochFreeField<SImpl>::execute(void)
     auto    &w                = envGet(ComplexField, "_" + getName() + "_weight");
     auto    &rng              = rng4d();
     double  trphi2;
-    FFT     fft(envGetGrid(Field));
+    auto    &fft              = envGetFft(Field);
     Integer vol;
 
     vol = 1;
@@ -164,7 +164,9 @@ void TStochFreeField<SImpl>::execute(void)
     }
     phift *= w;
     LOG(Message) << "Field Fourier transform" << std::endl;
+    startTimer("Fourier transform");
     fft.FFT_all_dim(phi, phift, FFT::backward);
+    stopTimer("Fourier transform");
     phi = 0.5*(phi - adj(phi));
     trphi2 = -TensorRemove(sum(trace(phi*phi))).real()/vol;
     LOG(Message) << "tr(phi^2)= " << trphi2 << std::endl;
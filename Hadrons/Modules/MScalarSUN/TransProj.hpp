@@ -141,19 +141,16 @@ void TTransProj<SImpl>::execute(void)
                  << par().type << " derivatives and op= '" << par().op 
                  << "'" << std::endl; 
 
-    const unsigned int nd = env().getNd();
-    TransProjResult    result;
-    auto               &op = envGet(ComplexField, par().op);
+    const unsigned int                nd = env().getNd();
+    TransProjResult                   result;
+    auto                              &op = envGet(ComplexField, par().op);
+    std::vector<const ComplexField *> proj;
+    std::vector<TComplex>             projSum;
 
     envGetTmp(ComplexField, buf1);
     envGetTmp(ComplexField, buf2);
     envGetTmp(ComplexField, lap);
     lap = Zero();
-    if (!par().output.empty())
-    {
-        result.type = par().type;
-        result.value.resize(nd, std::vector<Complex>(nd));
-    }
     for (unsigned int mu = 0; mu < nd; ++mu)
     {
         dmu(buf1, op, mu, par().type);
@@ -171,10 +168,22 @@ void TTransProj<SImpl>::execute(void)
         {
             out += lap;
         }
-        if (!par().output.empty())
+        proj.push_back(&out);
+    }
+    if (!par().output.empty())
+    {
+        unsigned int i = 0;
+
+        // all the volume sums are reduced in a single collective
+        batchSum(projSum, proj);
+        result.type = par().type;
+        result.value.resize(nd, std::vector<Complex>(nd));
+        for (unsigned int mu = 0; mu < nd; ++mu)
+        for (unsigned int nu = mu; nu < nd; ++nu)
         {
-            result.value[mu][nu] = TensorRemove(sum(out));
-            result.value[mu][nu] = result.value[nu][mu];
+            result.value[mu][nu] = TensorRemove(projSum[i]);
+            result.value[nu][mu] = result.value[mu][nu];
+            i++;
         }
     }
 
@@ -160,15 +160,15 @@ void TTwoPoint<SImpl>::execute(void)
 
     const unsigned int                           nd      = env().getNd();
     const unsigned int                           nt      = env().getDim().back();
-    const unsigned int                           nop     = par().op.size();
     const unsigned int                           nmom    = mom_.size();
     double                                       partVol = 1.;
     std::vector<int>                             dMask(nd, 1);
     std::set<std::string>                        ops;
     std::vector<TwoPointResult>                  result;
     std::map<std::string, std::vector<SlicedOp>> slicedOp;
-    FFT                                          fft(envGetGrid(Field));
-    TComplex                                     buf;
+    auto                                         &fft    = envGetFft(Field);
+    std::vector<Coordinate>                      site;
+    std::vector<TComplex>                        buf;
 
     envGetTmp(ComplexField, ftBuf);
     dMask[nd - 1] = 0;
@@ -181,25 +181,26 @@ void TTwoPoint<SImpl>::execute(void)
         ops.insert(p.first);
         ops.insert(p.second);
     }
+    site = timeMomentumSites(mom_, nt, nd - 1);
     for (auto &o: ops)
     {
         auto &op = envGet(ComplexField, o);
 
         slicedOp[o].resize(nmom);
         LOG(Message) << "Operator '" << o << "' FFT" << std::endl;
+        startTimer("Fourier transform");
         fft.FFT_dim_mask(ftBuf, op, dMask, FFT::forward);
+        stopTimer("Fourier transform");
+        gatherSites(buf, ftBuf, site);
         for (unsigned int m = 0; m < nmom; ++m)
         {
-            auto qt = mom_[m];
+            SlicedOp opt(nt);
 
-            qt.resize(nd);
-            slicedOp[o][m].resize(nt);
             for (unsigned int t = 0; t < nt; ++t)
             {
-                qt[nd - 1] = t;
-                peekSite(buf, ftBuf, qt);
-                slicedOp[o][m][t] = TensorRemove(buf);
+                opt[t] = TensorRemove(buf[m*nt + t]);
             }
+            timeFourier(slicedOp[o][m], opt, -1);
         }
     }
     LOG(Message) << "Making contractions" << std::endl;
@@ -211,8 +212,8 @@ void TTwoPoint<SImpl>::execute(void)
         r.sink   = p.first;
         r.source = p.second;
         r.mom    = mom_[m];
-        r.data   = makeTwoPoint(slicedOp[p.first][m], slicedOp[p.second][m], 
-                                1./partVol);
+        r.data   = makeTwoPointFourier(slicedOp[p.first][m], 
+                                       slicedOp[p.second][m], 1./partVol);
         result.push_back(r);
     }
     saveResult(par().output, "twopt", result);
@@ -135,26 +135,47 @@ void TTwoPointNPR<SImpl>::execute(void)
     const unsigned int             nd   = env().getNd();
     const unsigned int             nl   = env().getDim(0);
     const Real                     invV = 1./env().getVolume();
-    FFT                            fft(envGetGrid(Field));
+    auto                           &fft = envGetFft(Field);
     std::vector<TwoPointNPRResult> result;
     TwoPointNPRResult              twoPtp1, twoPtp2, twoPtDisc;
     auto                           &phi    = envGet(Field, par().field);
     bool                           doAux = true;
+    std::vector<Coordinate>        p1(nl, Coordinate(nd, 0)), p2(p1), p(p1);
+    std::vector<Site>              phip1, phip2;
+    std::vector<TComplex>          opp;
 
     envGetTmp(ComplexField, ftBuf);
     envGetTmp(Field, ftMatBuf);
+    for (unsigned int n = 0; n < nl; ++n)
+    {
+        // non-exceptional RI/SMOM kinematic
+        // p1 = mu*(1,1,0): in mom
+        // p2 = mu*(0,1,1): out mom
+        // p  = p1 - p2 = mu*(1,0,-1)
+        // mu = 2*n*pi/L
+        p1[n][0] = n;
+        p1[n][1] = n;
+        p2[n][1] = n;
+        p2[n][2] = n;
+        p[n][0]  = n;
+        p[n][2]  = (nl - n) % nl;
+    }
     LOG(Message) << "FFT: field '" << par().field << "'" << std::endl;
+    startTimer("Fourier transform");
     fft.FFT_all_dim(ftMatBuf, phi, FFT::forward);
+    stopTimer("Fourier transform");
+    gatherSites(phip1, ftMatBuf, p1);
+    gatherSites(phip2, ftMatBuf, p2);
     for (auto &opName: par().op)
     {
         auto              &op = envGet(ComplexField, opName);
-        std::vector<int>  p1, p2, p;
-        Site              phip1, phip2;
-        TComplex          opp;
         TwoPointNPRResult r, rDisc;
 
         LOG(Message) << "FFT: operator '" << opName << "'" << std::endl;
+        startTimer("Fourier transform");
         fft.FFT_all_dim(ftBuf, op, FFT::forward);
+        stopTimer("Fourier transform");
+        gatherSites(opp, ftBuf, p);
         LOG(Message) << "Generating vertex function" << std::endl;
         r.op = opName;
         r.data.resize(nl);
@@ -171,31 +192,14 @@ void TTwoPointNPR<SImpl>::execute(void)
         }
         for (unsigned int n = 0; n < nl; ++n)
         {
-            p1.assign(nd, 0);
-            p2.assign(nd, 0);
-            p.assign(nd, 0);
-            // non-exceptional RI/SMOM kinematic
-            // p1 = mu*(1,1,0): in mom
-            // p2 = mu*(0,1,1): out mom
-            // p  = p1 - p2 = mu*(1,0,-1)
-            // mu = 2*n*pi/L
-            p1[0] = n;
-            p1[1] = n;
-            p2[1] = n;
-            p2[2] = n;
-            p[0]  = n;
-            p[2]  = (nl - n) % nl;
-            peekSite(phip1, ftMatBuf, p1);
-            peekSite(phip2, ftMatBuf, p2);
-            peekSite(opp, ftBuf, p);
             if (doAux)
             {
-                twoPtp1.data[n]   = invV*TensorRemove(trace(phip1*adj(phip1)));
-                twoPtp2.data[n]   = invV*TensorRemove(trace(phip2*adj(phip2)));
-                twoPtDisc.data[n] = invV*TensorRemove(trace(phip2*adj(phip1)));
+                twoPtp1.data[n]   = invV*TensorRemove(trace(phip1[n]*adj(phip1[n])));
+                twoPtp2.data[n]   = invV*TensorRemove(trace(phip2[n]*adj(phip2[n])));
+                twoPtDisc.data[n] = invV*TensorRemove(trace(phip2[n]*adj(phip1[n])));
             }
-            r.data[n]     = invV*TensorRemove(trace(phip2*adj(phip1))*opp);
-            rDisc.data[n] = invV*TensorRemove(trace(phip1*adj(phip1))*opp);
+            r.data[n]     = invV*TensorRemove(trace(phip2[n]*adj(phip1[n]))*opp[n]);
+            rDisc.data[n] = invV*TensorRemove(trace(phip1[n]*adj(phip1[n]))*opp[n]);
         }
         if (doAux)
         {
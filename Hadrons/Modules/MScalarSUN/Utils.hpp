@@ -28,6 +28,7 @@
 
 #include <Hadrons/Global.hpp>
 #include <Hadrons/Module.hpp>
+#include <Hadrons/LatticeUtilities.hpp>
 
 BEGIN_HADRONS_NAMESPACE
 
@@ -109,6 +110,91 @@ std::vector<Complex> makeTwoPoint(const std::vector<SinkSite>   &sink,
     return res;
 }
 
+// mixed-radix Fourier transform of the n values in[0], in[stride], ...
+// out[k] = sum_t in[t*stride]*exp(sign*2*pi*i*k*t/n)
+inline void timeFourier(Complex *out, const Complex *in, const unsigned int n,
+                        const unsigned int stride, const int sign)
+{
+    if (n == 1)
+    {
+        out[0] = in[0];
+        return;
+    }
+
+    unsigned int         p = 2, m;
+    std::vector<Complex> buf(n);
+
+    while (n % p != 0)
+    {
+        ++p;
+    }
+    m = n/p;
+    for (unsigned int r = 0; r < p; ++r)
+    {
+        timeFourier(out + r*m, in + r*stride, m, stride*p, sign);
+    }
+    for (unsigned int q = 0; q < p; ++q)
+    for (unsigned int k = 0; k < m; ++k)
+    {
+        const unsigned int j = k + q*m;
+
+        buf[j] = 0.;
+        for (unsigned int r = 0; r < p; ++r)
+        {
+            buf[j] += out[r*m + k]*std::polar(static_cast<Real>(1.),
+                                              static_cast<Real>(sign*2.*M_PI*r*j/n));
+        }
+    }
+    std::copy(buf.begin(), buf.end(), out);
+}
+
+inline void timeFourier(std::vector<Complex> &out, const std::vector<Complex> &in,
+                        const int sign)
+{
+    out.resize(in.size());
+    if (!in.empty())
+    {
+        timeFourier(out.data(), in.data(), in.size(), 1, sign);
+    }
+}
+
+// two-point function from the time Fourier transforms (sign -1) of the sink
+// and source, using the correlation theorem
+inline std::vector<Complex> makeTwoPointFourier(const std::vector<Complex> &ftSink,
+                                                const std::vector<Complex> &ftSource,
+                                                const double factor = 1.)
+{
+    assert(ftSink.size() == ftSource.size());
+
+    unsigned int         nt = ftSink.size();
+    std::vector<Complex> prod(nt), res;
+
+    for (unsigned int k = 0; k < nt; ++k)
+    {
+        prod[k] = ftSink[k]*conj(ftSource[k]);
+    }
+    timeFourier(res, prod, 1);
+    for (auto &r: res)
+    {
+        r *= factor/static_cast<double>(nt*nt);
+    }
+
+    return res;
+}
+
+// scalar operators: O(nt*log(nt)) correlation through time Fourier transforms
+inline std::vector<Complex> makeTwoPoint(const std::vector<Complex> &sink,
+                                         const std::vector<Complex> &source,
+                                         const double factor = 1.)
+{
+    std::vector<Complex> ftSink, ftSource;
+
+    timeFourier(ftSink, sink, -1);
+    timeFourier(ftSource, source, -1);
+
+    return makeTwoPointFourier(ftSink, ftSource, factor);
+}
+
 inline std::string varName(const std::string name, const std::string suf)
 {
     return name + "_" + suf;
@@ -126,15 +126,19 @@ void TWilsonFlow<SImpl>::execute(void)
     auto    &flowed_phi       = envGet(Field, getName());
     envGetTmp(Field, phift);
     envGetTmp(ComplexField, flowfactor);
-    FFT     fft(envGetGrid(Field));
+    auto    &fft              = envGetFft(Field);
 
     
+    startTimer("Fourier transform");
     fft.FFT_all_dim(phift, phi, FFT::forward);
+    stopTimer("Fourier transform");
     SImpl::MomentaSquare(flowfactor);
     LOG(Message) << "     flowtime = " << par().flowtime << std::endl;
     flowfactor = exp(-par().flowtime*flowfactor);
     phift *= flowfactor;
-    fft.FFT_all_dim(flowed_phi, phift, FFT::backward);    
+    startTimer("Fourier transform");
+    fft.FFT_all_dim(flowed_phi, phift, FFT::backward);
+    stopTimer("Fourier transform");
 }
 
 END_MODULE_NAMESPACE
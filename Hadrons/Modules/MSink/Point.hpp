@@ -70,9 +70,6 @@ protected:
     virtual void setup(void);
     // execution
     virtual void execute(void);
-private:
-    bool        hasPhase_{false}; 
-    std::string momphName_;
 };
 
 typedef Lattice<iScalar<iMatrix<iScalar<vComplex>,Ns>>> SpinMatField;
@@ -88,7 +85,6 @@ MODULE_REGISTER_TMP(SMatPoint,   TPoint<SpinMatField>           , MSink);
 template <typename Field>
 TPoint<Field>::TPoint(const std::string name)
 : Module<PointPar>(name)
-, momphName_ (name + "_momph")
 {}
 
 // dependencies/products ///////////////////////////////////////////////////////
@@ -112,9 +108,14 @@ std::vector<std::string> TPoint<Field>::getOutput(void)
 template <typename Field>
 void TPoint<Field>::setup(void)
 {
-    envTmpLat(LatticeComplex, "coor");
-    envCacheLat(LatticeComplex, momphName_);
+    std::vector<Real> mom = strToVec<Real>(par().mom);
+
+    envCachePhase(LatticeComplex, mom);
     envCreate(SinkFn, getName(), 1, nullptr);
+    // the sink function refers to the shared phase, which must outlive it
+    env().addObjectDependency(
+        env().getObjectAddress(PhaseCache<LatticeComplex>::name(mom, envGetGrid(LatticeComplex))),
+        env().getObjectAddress(getName()));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -124,29 +125,12 @@ void TPoint<Field>::execute(void)
     LOG(Message) << "Setting up point sink function for momentum ["
                  << par().mom << "]" << std::endl;
 
-    auto &ph = envGet(LatticeComplex, momphName_);
-    
-    if (!hasPhase_)
-    {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, coor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
-        for(unsigned int mu = 0; mu < p.size(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*coor;
-        }
-        ph = exp((Real)(2*M_PI)*i*ph);
-        hasPhase_ = true;
-    }
-    auto sink = [this](const PropagatorField &field)
+    const LatticeComplex *ph = &envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
+
+    auto sink = [ph](const PropagatorField &field)
     {
         SlicedPropagator res;
-        auto             &ph = envGet(LatticeComplex, momphName_);
-        PropagatorField  tmp = ph*field;
+        PropagatorField  tmp = (*ph)*field;
         
         sliceSum(tmp, res, Tp);
         
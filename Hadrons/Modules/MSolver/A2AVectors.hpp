@@ -47,13 +47,17 @@ BEGIN_MODULE_NAMESPACE(MSolver)
 class A2AVectorsPar: Serializable
 {
 public:
+  A2AVectorsPar(void): multiFile{false}, batchSize{1} {};
+public:
+  // batchSize: number of high modes solved together (0 is equivalent to 1)
   GRID_SERIALIZABLE_CLASS_MEMBERS(A2AVectorsPar,
-                                  std::string, noise,
-                                  std::string, action,
-                                  std::string, eigenPack,
-                                  std::string, solver,
-                                  std::string, output,
-                                  bool,        multiFile);
+                                  std::string,  noise,
+                                  std::string,  action,
+                                  std::string,  eigenPack,
+                                  std::string,  solver,
+                                  std::string,  output,
+                                  bool,         multiFile,
+                                  unsigned int, batchSize);
 };
 
 template <typename FImpl, typename Pack>
@@ -77,7 +81,7 @@ public:
     virtual void execute(void);
 private:
     std::string  solverName_;
-    unsigned int Nl_{0};
+    unsigned int Nl_{0}, batchSize_{1};
 };
 
 MODULE_REGISTER_TMP(A2AVectors, 
@@ -140,10 +144,19 @@ void TA2AVectors<FImpl, Pack>::setup(void)
               Nl_ + noise.fermSize(), envGetGrid(FermionField));
     envCreate(std::vector<FermionField>, getName() + "_w", 1, 
               Nl_ + noise.fermSize(), envGetGrid(FermionField));
+    batchSize_ = std::max(1u, std::min(par().batchSize, 
+                                       static_cast<unsigned int>(noise.fermSize())));
+    envTmp(std::vector<FermionField>, "noiseBuf", env().getObjectLs(par().noise),
+           batchSize_, noise.getGrid());
     if (Ls > 1)
     {
         envTmpLat(FermionField, "f5", Ls);
+        envTmp(std::vector<FermionField>, "src5", Ls, batchSize_, 
+               envGetGrid(FermionField, Ls));
+        envTmp(std::vector<FermionField>, "sol5", Ls, batchSize_, 
+               envGetGrid(FermionField, Ls));
     }
+    envTmp(std::vector<FermionField>, "sol", 1, batchSize_, envGetGrid(FermionField));
     envTmp(A2A, "a2a", 1, action, solver);
 }
 
@@ -175,68 +188,82 @@ void TA2AVectors<FImpl, Pack>::execute(void)
                      << " using noise '" << par().noise << "' (" << noise.fermSize() 
                      << " noise vectors)" << std::endl;
     }
-    // Low modes
+    // Low modes, V and W in a single pass per eigenvector
     for (unsigned int il = 0; il < Nl_; il++)
     {
         auto &epack  = envGet(Pack, par().eigenPack);
 
-        startTimer("V low mode");
-        LOG(Message) << "V vector i = " << il << " (low mode)" << std::endl;
-        if (Ls == 1)
-        {
-            a2a.makeLowModeV(v[il], epack.evec[il], epack.eval[il]);
-        }
-        else
-        {
-            envGetTmp(FermionField, f5);
-            a2a.makeLowModeV5D(v[il], f5, epack.evec[il], epack.eval[il]);
-        }
-        stopTimer("V low mode");
-        startTimer("W low mode");
-        LOG(Message) << "W vector i = " << il << " (low mode)" << std::endl;
+        startTimer("V & W low mode");
+        LOG(Message) << "V & W vectors i = " << il << " (low mode)" << std::endl;
         if (Ls == 1)
         {
-            a2a.makeLowModeW(w[il], epack.evec[il], epack.eval[il]);
+            a2a.makeLowModeVW(v[il], w[il], epack.evec[il], epack.eval[il]);
         }
         else
         {
             envGetTmp(FermionField, f5);
-            a2a.makeLowModeW5D(w[il], f5, epack.evec[il], epack.eval[il]);
+            a2a.makeLowModeVW5D(v[il], w[il], f5, epack.evec[il], epack.eval[il]);
         }
-        stopTimer("W low mode");
+        stopTimer("V & W low mode");
     }
 
-    // High modes
-    for (unsigned int ih = 0; ih < noise.fermSize(); ih++)
+    // High modes, solved by batches
+    envGetTmp(std::vector<FermionField>, noiseBuf);
+    envGetTmp(std::vector<FermionField>, sol);
+    for (unsigned int ih = 0; ih < noise.fermSize(); ih += batchSize_)
     {
-        startTimer("V high mode");
-        LOG(Message) << "V vector i = " << Nl_ + ih
-                     << " (" << ((Nl_ > 0) ? "high " : "") 
-                     << "stochastic mode)" << std::endl;
-        if (Ls == 1)
+        unsigned int nb = std::min(batchSize_, noise.fermSize() - ih);
+
+        // the last batch can be smaller, the temporaries are not used after
+        if (nb < noiseBuf.size())
         {
-            a2a.makeHighModeV(v[Nl_ + ih], noise.getFerm(ih));
+            noiseBuf.erase(noiseBuf.begin() + nb, noiseBuf.end());
+            sol.erase(sol.begin() + nb, sol.end());
         }
-        else
+        startTimer("W high mode");
+        for (unsigned int k = 0; k < nb; ++k)
         {
-            envGetTmp(FermionField, f5);
-            a2a.makeHighModeV5D(v[Nl_ + ih], f5, noise.getFerm(ih));
+            LOG(Message) << "W vector i = " << Nl_ + ih + k
+                         << " (" << ((Nl_ > 0) ? "high " : "") 
+                         << "stochastic mode)" << std::endl;
+            noiseBuf[k] = noise.getFerm(ih + k);
+            if (Ls == 1)
+            {
+                a2a.makeHighModeW(w[Nl_ + ih + k], noiseBuf[k]);
+            }
+            else
+            {
+                envGetTmp(FermionField, f5);
+                a2a.makeHighModeW5D(w[Nl_ + ih + k], f5, noiseBuf[k]);
+            }
         }
-        stopTimer("V high mode");
-        startTimer("W high mode");
-        LOG(Message) << "W vector i = " << Nl_ + ih
+        stopTimer("W high mode");
+        startTimer("V high mode");
+        LOG(Message) << "V vectors i = " << Nl_ + ih << ".." << Nl_ + ih + nb - 1
                      << " (" << ((Nl_ > 0) ? "high " : "") 
-                     << "stochastic mode)" << std::endl;
+                     << "stochastic modes, batch of " << nb << ")" << std::endl;
         if (Ls == 1)
         {
-            a2a.makeHighModeW(w[Nl_ + ih], noise.getFerm(ih));
+            a2a.makeHighModeV(sol, noiseBuf);
         }
         else
         {
-            envGetTmp(FermionField, f5);
-            a2a.makeHighModeW5D(w[Nl_ + ih], f5, noise.getFerm(ih));
+            envGetTmp(std::vector<FermionField>, src5);
+            envGetTmp(std::vector<FermionField>, sol5);
+
+            if (nb < src5.size())
+            {
+                src5.erase(src5.begin() + nb, src5.end());
+                sol5.erase(sol5.begin() + nb, sol5.end());
+            }
+            a2a.makeHighModeV5D(sol, sol5, src5, noiseBuf);
         }
-        stopTimer("W high mode");
+        // the solutions are swapped in place, without copies
+        for (unsigned int k = 0; k < nb; ++k)
+        {
+            std::swap(v[Nl_ + ih + k], sol[k]);
+        }
+        stopTimer("V high mode");
     }
 
     // I/O if necessary
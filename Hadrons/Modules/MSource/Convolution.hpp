@@ -109,7 +109,6 @@ void TConvolution<FImpl>::setup(void)
 
     envCreateLat(PropagatorField, getName());
     envTmpLat(ComplexField, "momfield");
-    envTmp(FFT, "fft", 1, env().getGrid());
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -120,7 +119,7 @@ void TConvolution<FImpl>::execute(void)
     auto &field  = envGet(PropagatorField, par().field);
     auto &out    = envGet(PropagatorField, getName());
     envGetTmp(ComplexField, momfield);
-    envGetTmp(FFT, fft);
+    auto &fft    = env().getFft(env().getGrid());
 
     std::vector<int> mask(env().getNd(), 1);
     mask.back()=0; //transform only the spatial dimensions
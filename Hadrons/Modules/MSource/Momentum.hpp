@@ -103,8 +103,7 @@ template <typename FImpl>
 void TMomentum<FImpl>::setup(void)
 {
     envCreateLat(PropagatorField, getName());
-    envTmpLat(ComplexField, "C");
-    envTmpLat(ComplexField, "xMu");
+    envCachePhase(ComplexField, strToVec<Real>(par().mom));
 }
 
 //execution//////////////////////////////////////////////////////////////////
@@ -113,22 +112,9 @@ void TMomentum<FImpl>::execute(void)
 {
     LOG(Message) << "Generating planewave momentum source with momentum " << par().mom << std::endl;
     PropagatorField        &src = envGet(PropagatorField, getName());
-    std::vector<Real>      p = strToVec<Real>(par().mom);;
-    Coordinate                  latt_size = GridDefaultLatt();
-    Complex                Ci(0.0,1.0);
-    envGetTmp(ComplexField, C);
-    envGetTmp(ComplexField, xMu);
 
     src = Zero();
-    C = Zero();
-
-    for(int mu = 0; mu < Nd; mu++){
-        Real TwoPiL =  M_PI * 2.0 / latt_size[mu];
-        LatticeCoordinate(xMu,mu);
-        C = C + (TwoPiL * p[mu]) * xMu;
-    }
-    C = exp(C*Ci);
-    src = src + C;
+    src = src + envGetPhase(ComplexField, strToVec<Real>(par().mom));
     LOG(Message) << "source created" << std::endl;
 }
 
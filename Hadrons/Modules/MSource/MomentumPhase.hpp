@@ -77,8 +77,8 @@ protected:
     // execution
     virtual void execute(void);
 private:
-    bool        hasPhase_{false};
-    std::string momphName_, tName_;
+    bool        hasT_{false};
+    std::string tName_;
 };
 
 MODULE_REGISTER_TMP(MomentumPhase, TMomentumPhase<FIMPL>, MSource);
@@ -91,7 +91,6 @@ MODULE_REGISTER_TMP(ZMomentumPhase, TMomentumPhase<ZFIMPL>, MSource);
 template <typename FImpl>
 TMomentumPhase<FImpl>::TMomentumPhase(const std::string name)
 : Module<MomentumPhasePar>(name)
-, momphName_ (name + "_momph")
 , tName_ (name + "_t")
 {}
 
@@ -118,8 +117,7 @@ void TMomentumPhase<FImpl>::setup(void)
 {
     envCreateLat(PropagatorField, getName());
     envCache(Lattice<iScalar<vInteger>>, tName_, 1, envGetGrid(LatticeComplex));
-    envCacheLat(LatticeComplex, momphName_);
-    envTmpLat(LatticeComplex, "coor");
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -131,25 +129,13 @@ void TMomentumPhase<FImpl>::execute(void)
                  << par().mom << std::endl;
     auto  &out = envGet(PropagatorField, getName());
     auto  &src   = envGet(PropagatorField, par().src);
-    auto  &ph  = envGet(LatticeComplex, momphName_);
+    auto  &ph  = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     auto  &t   = envGet(Lattice<iScalar<vInteger>>, tName_);
     
-    if (!hasPhase_)
+    if (!hasT_)
     {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, coor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
-        for(unsigned int mu = 0; mu < env().getNd(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*coor;
-        }
-        ph = exp((Real)(2*M_PI)*i*ph);
         LatticeCoordinate(t, Tp);
-        hasPhase_ = true;
+        hasT_ = true;
     }
     out = ph*src;
 }
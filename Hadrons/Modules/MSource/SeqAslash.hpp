@@ -91,8 +91,8 @@ protected:
 private:
     void makeSource(PropagatorField &src, const PropagatorField &q);
 private:
-    bool        hasPhase_{false};
-    std::string momphName_, tName_;
+    bool        hasT_{false};
+    std::string tName_;
 };
 
 MODULE_REGISTER_TMP(SeqAslash, TSeqAslash<FIMPL>, MSource);
@@ -104,7 +104,6 @@ MODULE_REGISTER_TMP(SeqAslash, TSeqAslash<FIMPL>, MSource);
 template <typename FImpl>
 TSeqAslash<FImpl>::TSeqAslash(const std::string name)
 : Module<SeqAslashPar>(name)
-, momphName_ (name + "_momph")
 , tName_ (name + "_t")
 {}
 
@@ -148,8 +147,7 @@ void TSeqAslash<FImpl>::setup(void)
                           + ")", env().getObjectAddress(par().q))
     }
     envCache(Lattice<iScalar<vInteger>>, tName_, 1, envGetGrid(LatticeComplex));
-    envCacheLat(LatticeComplex, momphName_);
-    envTmpLat(LatticeComplex, "coor");
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -157,26 +155,14 @@ template <typename FImpl>
 void TSeqAslash<FImpl>::makeSource(PropagatorField &src, 
                                    const PropagatorField &q)
 {
-    auto &ph           = envGet(LatticeComplex, momphName_);
+    auto &ph           = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     auto &t            = envGet(Lattice<iScalar<vInteger>>, tName_);
     auto &stoch_photon = envGet(EmField, par().emField);
 
-    if (!hasPhase_)
+    if (!hasT_)
     {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, coor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
-        for(unsigned int mu = 0; mu < env().getNd(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*coor;
-        }
-        ph = exp((Real)(2*M_PI)*i*ph);
         LatticeCoordinate(t, Tp);
-        hasPhase_ = true;
+        hasT_ = true;
     }
     
     Complex ci(0.0,1.0);
@@ -102,9 +102,6 @@ protected:
     virtual void execute(void);
 private:
     void makeSource(PropagatorField &src, PropagatorField &q, PropagatorField &physSrc);
-private:
-    bool        SeqhasPhase_{false}; 
-    std::string SeqmomphName_;
 };
 
 MODULE_REGISTER_TMP(SeqConserved, TSeqConserved<FIMPL>, MSource);
@@ -118,7 +115,6 @@ MODULE_REGISTER_TMP(ZSeqConserved, TSeqConserved<ZFIMPL>, MSource);
 template <typename FImpl>
 TSeqConserved<FImpl>::TSeqConserved(const std::string name)
 : Module<SeqConservedPar>(name)
-, SeqmomphName_ (name + "_Seqmomph")
 {}
 
 // dependencies/products ///////////////////////////////////////////////////////
@@ -186,8 +182,7 @@ void TSeqConserved<FImpl>::setup(void)
                           + env().getObjectType(par().q)
                           + ")", env().getObjectAddress(par().q))
     }
-    envCacheLat(LatticeComplex, SeqmomphName_);
-    envTmpLat(LatticeComplex, "coor");
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
     envTmpLat(LatticeComplex, "latt_compl");
 }
 
@@ -203,21 +198,7 @@ void TSeqConserved<FImpl>::makeSource(PropagatorField &src, PropagatorField &q,
     src     = Zero();
     src_tmp = src;
     //exp(ipx)
-    auto &mom_phase = envGet(LatticeComplex, SeqmomphName_);
-    if (!SeqhasPhase_)
-    {    
-        std::vector<Real> mom = strToVec<Real>(par().mom);
-        mom_phase = Zero();
-        Complex           i(0.0,1.0);
-        envGetTmp(LatticeComplex, coor);
-        for(unsigned int mu = 0; mu < env().getNd(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            mom_phase = mom_phase + (mom[mu]/env().getDim(mu))*coor;
-        }
-        mom_phase = exp((Real)(2*M_PI)*i*mom_phase);
-        SeqhasPhase_ = true;
-    }
+    auto &mom_phase = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     LOG(Message) << "Inserting momentum " << strToVec<Real>(par().mom) << std::endl;
     if (!par().photon.empty())    	
     {
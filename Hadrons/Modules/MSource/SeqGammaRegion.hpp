@@ -111,8 +111,7 @@ protected:
     Coordinate        RegionSize;
     Coordinate        Momentum;
     bool              bPropVec;
-    bool              hasPhase_{false};
-    const std::string momphName_;
+    bool              hasCoor_{false};
     const std::string coorName_;
 };
 
@@ -126,7 +125,6 @@ MODULE_REGISTER_TMP(ZSeqGammaRegion, TSeqGammaRegion<ZFIMPL>, MSource);
 template <typename FImpl>
 TSeqGammaRegion<FImpl>::TSeqGammaRegion(const std::string name)
 : Module<SeqGammaRegionPar>(name)
-, momphName_ (name + "_momph")
 , coorName_ (name + "_coor")
 {}
 
@@ -176,35 +174,25 @@ void TSeqGammaRegion<FImpl>::setup(void)
     Momentum   = SeqGammaRegionHelper::ErrorCheck<int>(par().mom       , env().getNd(), "mom");
     Gamma g(par().gamma);
     // Create temporaries
-    envCacheLat(LatticeComplex, momphName_);
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
     envCache(std::vector<LatSInt>, coorName_, 1, env().getNd(), envGetGrid(LatticeComplex)); // coords for where clause
-    envTmpLat(LatticeComplex, "pcoor"); // This temporary is used for momentum
 }
 
 // execution ///////////////////////////////////////////////////////////////////
 template <typename FImpl>
 void TSeqGammaRegion<FImpl>::makeSource(PropagatorField &src, const PropagatorField &q)
 {
-    auto &ph   = envGet(LatticeComplex, momphName_);
+    auto &ph   = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     auto &coor = envGet(std::vector<LatSInt>, coorName_);
     Gamma g(par().gamma);
 
-    if (!hasPhase_)
+    if (!hasCoor_)
     {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, pcoor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
         for(unsigned int mu = 0; mu < env().getNd(); mu++)
         {
-            LatticeCoordinate(pcoor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*pcoor;
             LatticeCoordinate(coor[mu], mu);
         }
-        ph = exp((Real)(2*M_PI)*i*ph);
-        hasPhase_ = true;
+        hasCoor_ = true;
     }
     src = where(    (coor[0] >= LowerLeft[0]) and (coor[0] < LowerLeft[0] + RegionSize[0])
                 and (coor[1] >= LowerLeft[1]) and (coor[1] < LowerLeft[1] + RegionSize[1])
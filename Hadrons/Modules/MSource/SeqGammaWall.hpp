@@ -93,8 +93,8 @@ protected:
 private:
     void makeSource(PropagatorField &src, const PropagatorField &q);
 private:
-    bool        hasPhase_{false};
-    std::string momphName_, tName_;
+    bool        hasT_{false};
+    std::string tName_;
 };
 
 MODULE_REGISTER_TMP(SeqGammaWall, TSeqGammaWall<FIMPL>, MSource);
@@ -107,7 +107,6 @@ MODULE_REGISTER_TMP(ZSeqGammaWall, TSeqGammaWall<ZFIMPL>, MSource);
 template <typename FImpl>
 TSeqGammaWall<FImpl>::TSeqGammaWall(const std::string name)
 : Module<SeqGammaWallPar>(name)
-, momphName_ (name + "_momph")
 , tName_ (name + "_t")
 {}
 
@@ -151,8 +150,7 @@ void TSeqGammaWall<FImpl>::setup(void)
                           + ")", env().getObjectAddress(par().q))
     }
     envCache(Lattice<iScalar<vInteger>>, tName_, 1, envGetGrid(LatticeComplex));
-    envCacheLat(LatticeComplex, momphName_);
-    envTmpLat(LatticeComplex, "coor");
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
     envTmpLat(PropagatorField, "wallTmp");
 }
 
@@ -161,26 +159,14 @@ template <typename FImpl>
 void TSeqGammaWall<FImpl>::makeSource(PropagatorField &src,
                                   const PropagatorField &q)
 {
-    auto  &ph  = envGet(LatticeComplex, momphName_);
+    auto  &ph  = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     auto  &t   = envGet(Lattice<iScalar<vInteger>>, tName_);
     Gamma g(par().gamma);
     
-    if (!hasPhase_)
+    if (!hasT_)
     {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, coor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
-        for(unsigned int mu = 0; mu < env().getNd(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*coor;
-        }
-        ph = exp((Real)(2*M_PI)*i*ph);
         LatticeCoordinate(t, Tp);
-        hasPhase_ = true;
+        hasT_ = true;
     }
     envGetTmp(PropagatorField, wallTmp);
     SlicedPropagator qSliced;
@@ -81,8 +81,8 @@ protected:
     // execution
     virtual void execute(void);
 private:
-    bool        hasPhase_{false};
-    std::string momphName_, tName_;
+    bool        hasT_{false};
+    std::string tName_;
 };
 
 MODULE_REGISTER_TMP(Wall, TWall<FIMPL>, MSource);
@@ -94,7 +94,6 @@ MODULE_REGISTER_TMP(Wall, TWall<FIMPL>, MSource);
 template <typename FImpl>
 TWall<FImpl>::TWall(const std::string name)
 : Module<WallPar>(name)
-, momphName_ (name + "_momph")
 , tName_ (name + "_t")
 {}
 
@@ -121,8 +120,7 @@ void TWall<FImpl>::setup(void)
 {
     envCreateLat(PropagatorField, getName());
     envCache(Lattice<iScalar<vInteger>>, tName_, 1, envGetGrid(LatticeComplex));
-    envCacheLat(LatticeComplex, momphName_);
-    envTmpLat(LatticeComplex, "coor");
+    envCachePhase(LatticeComplex, strToVec<Real>(par().mom));
 }
 
 // execution ///////////////////////////////////////////////////////////////////
@@ -133,25 +131,13 @@ void TWall<FImpl>::execute(void)
                  << " with momentum " << par().mom << std::endl;
     
     auto  &src = envGet(PropagatorField, getName());
-    auto  &ph  = envGet(LatticeComplex, momphName_);
+    auto  &ph  = envGetPhase(LatticeComplex, strToVec<Real>(par().mom));
     auto  &t   = envGet(Lattice<iScalar<vInteger>>, tName_);
     
-    if (!hasPhase_)
+    if (!hasT_)
     {
-        Complex           i(0.0,1.0);
-        std::vector<Real> p;
-
-        envGetTmp(LatticeComplex, coor);
-        p  = strToVec<Real>(par().mom);
-        ph = Zero();
-        for(unsigned int mu = 0; mu < p.size(); mu++)
-        {
-            LatticeCoordinate(coor, mu);
-            ph = ph + (p[mu]/env().getDim(mu))*coor;
-        }
-        ph = exp((Real)(2*M_PI)*i*ph);
         LatticeCoordinate(t, Tp);
-        hasPhase_ = true;
+        hasT_ = true;
     }
 
     src = 1.;
@@ -82,7 +82,7 @@ void TFFT<Field>::execute(void)
     auto &out = envGet(Field, getName());
     GridBase *g = field.Grid();
     unsigned int nd = env().getNd(), nt = env().getDim(Tp);
-    FFT fft(dynamic_cast<GridCartesian *>(g));
+    auto &fft = env().getFft(g);
     std::vector<int> maskv = strToVec<int>(par().dimMask);
     Coordinate mask(maskv);
 
@@ -97,7 +97,9 @@ void TFFT<Field>::execute(void)
     LOG(Message) << "Performing FFT on field '" << par().field << "'" << std::endl;
     LOG(Message) << "Dimension mask: " << maskv << std::endl;
     LOG(Message) << "     Direction: " << (par().backward ? "backward" : "forward") << std::endl;
+    startTimer("Fourier transform");
     fft.FFT_dim_mask(out, field, mask, par().backward ? FFT::backward : FFT::forward);
+    stopTimer("Fourier transform");
 }
 
 END_MODULE_NAMESPACE
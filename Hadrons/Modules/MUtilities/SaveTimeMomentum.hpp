@@ -5,6 +5,7 @@
 #include <Hadrons/Module.hpp>
 #include <Hadrons/ModuleFactory.hpp>
 #include <Hadrons/EmField.hpp>
+#include <Hadrons/LatticeUtilities.hpp>
 #include <Hadrons/Serialization.hpp>
 
 BEGIN_HADRONS_NAMESPACE
@@ -102,8 +103,7 @@ template <typename Field>
 void TSaveTimeMomentum<Field>::execute(void)
 {
     auto &field = envGet(Field, par().tmomField);
-    unsigned int nd = env().getNd(), nt = env().getDim(Tp);
-    Coordinate site(nd);
+    unsigned int nt = env().getDim(Tp);
     std::vector<int> mom = strToVec<int>(par().momentum);
     Result result;
 
@@ -112,22 +112,7 @@ void TSaveTimeMomentum<Field>::execute(void)
         HADRONS_ERROR(Size, "momentum has " + std::to_string(mom.size())
                       + " components (must have " + std::to_string(env().getNd() - 1) + ")");
     }
-    result.corr.resize(nt);
-    unsigned int j = 0;
-    Site f;
-    for (unsigned int d = 0; d < nd; ++d)
-    {
-        if (d != Tp)
-        {
-            site[d] = mom[j];
-            j++;
-        }
-    }
-    for (unsigned int t = 0; t < nt; ++t)
-    {
-        site[Tp] = t;
-        peekSite(result.corr[t], field, site);
-    }
+    gatherSites(result.corr, field, timeMomentumSites({mom}, nt, Tp));
     result.info.momentum = mom;
     saveResult(par().output, "meson", result);
     auto &out = envGet(HadronsSerializable, getName());
@@ -0,0 +1,168 @@
+/*
+ * PhaseCache.hpp, part of Hadrons (https://github.com/aportelli/Hadrons)
+ *
+ * Copyright (C) 2015 - 2023
+ *
+ * Author: Antonin Portelli <antonin.portelli@me.com>
+ *
+ * Hadrons is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Hadrons is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hadrons.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See the full license in the file "LICENSE" in the top level distribution
+ * directory.
+ */
+
+/*  END LEGAL */
+
+#ifndef Hadrons_PhaseCache_hpp_
+#define Hadrons_PhaseCache_hpp_
+
+#include <Hadrons/Global.hpp>
+
+BEGIN_HADRONS_NAMESPACE
+
+/******************************************************************************
+ *                     Shared momentum phase field                            *
+ ******************************************************************************
+ * Holds the field exp(2*pi*i*sum_mu p_mu*x_mu/L_mu). One object exists per
+ * (momentum, grid, precision) in the environment and is shared by all the
+ * modules using this momentum (see envCachePhase and envGetPhase in 
+ * Module.hpp), it is freed after the last of them in the program. The field
+ * is built on first access from the
+ * plane-wave factorisation of the phase: one table of L_mu phases per
+ * direction, multiplied on each site, without coordinate fields or
+ * exponentials over the volume. The static build function can be used 
+ * directly for modules needing their own phase fields.
+ */
+template <typename Field>
+class PhaseCache
+{
+public:
+    typedef typename Field::scalar_type Scalar;
+public:
+    // constructor
+    PhaseCache(GridBase *g);
+    // destructor
+    virtual ~PhaseCache(void) = default;
+    // object name for a given momentum and grid
+    static std::string name(const std::vector<Real> &mom, GridBase *g);
+    // access (the field is built on first call)
+    const Field & get(const std::vector<Real> &mom);
+    // build a phase field from one table per direction
+    static void build(Field &phase, const std::vector<Real> &mom);
+private:
+    Field phase_;
+    bool  built_{false};
+};
+
+/******************************************************************************
+ *                      PhaseCache template implementation                    *
+ ******************************************************************************/
+// constructor /////////////////////////////////////////////////////////////////
+template <typename Field>
+PhaseCache<Field>::PhaseCache(GridBase *g)
+: phase_(g)
+{}
+
+// object name /////////////////////////////////////////////////////////////////
+template <typename Field>
+std::string PhaseCache<Field>::name(const std::vector<Real> &mom, GridBase *g)
+{
+    std::ostringstream name;
+
+    if (static_cast<int>(mom.size()) > g->Nd())
+    {
+        HADRONS_ERROR(Size, "momentum has more components than the grid dimension");
+    }
+    name << "_phase" << std::setprecision(17);
+    for (int mu = 0; mu < g->Nd(); ++mu)
+    {
+        name << "_" << ((mu < static_cast<int>(mom.size())) ? mom[mu] : 0.);
+    }
+    name << "_";
+    for (int mu = 0; mu < g->Nd(); ++mu)
+    {
+        name << ((mu > 0) ? "x" : "") << g->_fdimensions[mu];
+    }
+    name << ((sizeof(Scalar) == sizeof(ComplexF)) ? "_F" : "_D");
+
+    return name.str();
+}
+
+// access //////////////////////////////////////////////////////////////////////
+template <typename Field>
+const Field & PhaseCache<Field>::get(const std::vector<Real> &mom)
+{
+    if (!built_)
+    {
+        LOG(Message) << "Building momentum phase " << mom << std::endl;
+        build(phase_, mom);
+        built_ = true;
+    }
+
+    return phase_;
+}
+
+// build the phase from one table per direction ////////////////////////////////
+template <typename Field>
+void PhaseCache<Field>::build(Field &phase, const std::vector<Real> &mom)
+{
+    GridBase                           *g    = phase.Grid();
+    const int                          nd    = g->Nd(), nsimd = g->Nsimd();
+    std::vector<int>                   dir;
+    std::vector<std::vector<ComplexD>> table(nd);
+
+    if (static_cast<int>(mom.size()) > nd)
+    {
+        HADRONS_ERROR(Size, "momentum has more components than the grid dimension");
+    }
+    for (int mu = 0; mu < nd; ++mu)
+    {
+        const int  l = g->_fdimensions[mu];
+        const Real p = (mu < static_cast<int>(mom.size())) ? mom[mu] : 0.;
+
+        if (p != 0.)
+        {
+            dir.push_back(mu);
+            table[mu].resize(l);
+            for (int x = 0; x < l; ++x)
+            {
+                table[mu][x] = std::polar(1., 2.*M_PI*p*x/l);
+            }
+        }
+    }
+    autoView(pv, phase, CpuWrite);
+    thread_for(ss, g->oSites(),
+    {
+        Coordinate ocoor, icoor;
+        Scalar     *vp = reinterpret_cast<Scalar *>(&pv[ss]);
+
+        g->oCoorFromOindex(ocoor, ss);
+        for (int l = 0; l < nsimd; ++l)
+        {
+            ComplexD ph = 1.;
+
+            g->iCoorFromIindex(icoor, l);
+            for (auto mu: dir)
+            {
+                ph *= table[mu][g->_lstart[mu] + ocoor[mu]
+                                + icoor[mu]*g->_rdimensions[mu]];
+            }
+            vp[l] = ph;
+        }
+    });
+}
+
+END_HADRONS_NAMESPACE
+
+#endif // Hadrons_PhaseCache_hpp_
@@ -116,6 +116,8 @@ public:
     static NOT_SER_AND_STR(T, std::string) sqlStrFrom(const T &x);
     template <typename T>
     static NOT_SER_AND_NOT_STR(T, std::string) sqlStrFrom(const T &x);
+    // escape single quotes in a string to be used as an SQL literal
+    static std::string sqlEscape(const std::string &str);
     // parse string to an arbitrary type
     template <typename T>
     static T strTo(const std::string str);
@@ -229,6 +231,24 @@ NOT_SER_AND_NOT_STR(T, std::string) SqlEntry::sqlStrFrom(const T &x)
     return xmlStrFrom(x);
 }
 
+// escape single quotes in a string to be used as an SQL literal
+inline std::string SqlEntry::sqlEscape(const std::string &str)
+{
+    std::string res;
+
+    res.reserve(str.size());
+    for (auto c: str)
+    {
+        res += c;
+        if (c == '\'')
+        {
+            res += c;
+        }
+    }
+
+    return res;
+}
+
 // parse string to an arbitrary type
 template <typename T>
 T SqlEntry::strTo(const std::string str)
@@ -345,7 +365,7 @@ else\
         s = sqlStrFrom(B);\
         if (!s.empty())\
         {\
-            list += "'" + s + "'";\
+            list += "'" + sqlEscape(s) + "'";\
         }\
         else\
         {\
@@ -29,6 +29,7 @@
 #include <Hadrons/GeneticScheduler.hpp>
 #include <Hadrons/StatLogger.hpp>
 #include <Hadrons/ModuleFactory.hpp>
+#include <unistd.h>
 
 using namespace Grid;
  
@@ -185,6 +186,133 @@ VirtualMachine::Program VirtualMachine::dbRestoreSchedule(void)
     return program;
 }
 
+// checkpoint/resume ///////////////////////////////////////////////////////////
+void VirtualMachine::setResume(const bool resume)
+{
+    if (resume and !hasDatabase())
+    {
+        HADRONS_ERROR(Database, "resuming programs needs an application database");
+    }
+    resume_ = resume;
+    if (resume_)
+    {
+        if (!db_->tableExists("checkpoint"))
+        {
+            db_->createTable<CheckpointEntry>("checkpoint", "PRIMARY KEY(traj, module)");
+        }
+        if (!db_->tableExists("checkpointFiles"))
+        {
+            db_->createTable<CheckpointFileEntry>("checkpointFiles", 
+                                                  "PRIMARY KEY(traj, module, filename)");
+        }
+    }
+}
+
+bool VirtualMachine::getResume(void) const
+{
+    return resume_;
+}
+
+// record that a module completed for the current trajectory, together with
+// its output files
+void VirtualMachine::dbCheckpoint(const unsigned int address)
+{
+    CheckpointEntry     e;
+    CheckpointFileEntry f;
+    std::string         where = "WHERE traj = " + std::to_string(traj_) 
+                                + " AND module = '" + SqlEntry::sqlEscape(module_[address].name) + "';";
+
+    e.traj   = traj_;
+    e.module = module_[address].name;
+    f.traj   = traj_;
+    f.module = module_[address].name;
+    db_->execute("DELETE FROM checkpointFiles " + where);
+    for (auto &filename: module_[address].data->getOutputFiles())
+    {
+        f.filename = filename;
+        db_->insert("checkpointFiles", f, true);
+    }
+    db_->insert("checkpoint", e, true);
+}
+
+// program to run to complete the current trajectory: the modules not 
+// checkpointed (or with missing output files), and the modules producing the 
+// objects they need. The latter are executed again, since environment objects
+// only live in memory.
+VirtualMachine::Program VirtualMachine::dbResumeProgram(const Program &p)
+{
+    std::string               where = "WHERE traj = " + std::to_string(traj_);
+    auto                      done  = db_->getTable<CheckpointEntry>("checkpoint", where);
+    auto                      files = db_->getTable<CheckpointFileEntry>("checkpointFiles", where);
+    std::vector<int>          isDone(getNModule(), 0);
+    std::vector<bool>         isRun(getNModule(), false);
+    std::vector<unsigned int> stack;
+    Program                   resumed;
+    GridBase                  *grid = env().getGrid();
+
+    for (auto &e: done)
+    {
+        if (hasModule(e.module))
+        {
+            isDone[getModuleAddress(e.module)] = 1;
+        }
+    }
+    // output files are checked by the boss process only, so that all the
+    // processes agree on the program
+    if (grid->IsBoss())
+    {
+        for (auto &f: files)
+        {
+            if (hasModule(f.module) and (access(f.filename.c_str(), F_OK) != 0))
+            {
+                LOG(Warning) << "Output file '" << f.filename << "' of module '"
+                             << f.module << "' missing, module will run again" 
+                             << std::endl;
+                isDone[getModuleAddress(f.module)] = 0;
+            }
+        }
+    }
+    grid->Broadcast(grid->BossRank(), isDone.data(), isDone.size()*sizeof(int));
+    for (auto a: p)
+    {
+        if (!isDone[a])
+        {
+            isRun[a] = true;
+            stack.push_back(a);
+        }
+    }
+    while (!stack.empty())
+    {
+        unsigned int a = stack.back();
+
+        stack.pop_back();
+        for (auto o: module_[a].input)
+        {
+            int m = env().getObjectModule(o);
+
+            if ((m >= 0) and !isRun[m])
+            {
+                isRun[m] = true;
+                stack.push_back(m);
+            }
+        }
+    }
+    for (auto a: p)
+    {
+        if (isRun[a])
+        {
+            resumed.push_back(a);
+        }
+        else
+        {
+            LOG(Message) << "Module '" << module_[a].name << "' completed, skipped"
+                         << std::endl;
+        }
+    }
+
+    return resumed;
+}
+
 bool VirtualMachine::hasDatabase(void) const
 {
     return ((db_ != nullptr) and db_->isConnected());
@@ -226,6 +354,10 @@ void VirtualMachine::initDatabase(void)
         LOG(Message) << "The object table in '" << db_->getFilename() << "' is not empty, it will not be altered" << std::endl;
         makeObjectDb_ = false;
     }
+    if (!db_->tableExists("moduleTimes"))
+    {
+        db_->createTable<ModuleTimeEntry>("moduleTimes", "PRIMARY KEY(module)");
+    }
     if (!db_->tableExists("schedule"))
     {
         db_->createTable<ScheduleEntry>("schedule", "PRIMARY KEY(step)," 
@@ -477,6 +609,22 @@ std::string VirtualMachine::getModuleName(const unsigned int address) const
     }
 }
 
+void VirtualMachine::addSharedObjectUser(const unsigned int objAddress,
+                                         const unsigned int moduleAddress)
+{
+    if (!hasModule(moduleAddress))
+    {
+        HADRONS_ERROR(Definition, "no module with address " + std::to_string(moduleAddress));
+    }
+
+    auto &shared = module_[moduleAddress].shared;
+
+    if (std::find(shared.begin(), shared.end(), objAddress) == shared.end())
+    {
+        shared.push_back(objAddress);
+    }
+}
+
 std::string VirtualMachine::getModuleType(const unsigned int address) const
 {
     if (hasModule(address))
@@ -781,48 +929,79 @@ void VirtualMachine::memoryProfile(const std::string name)
 VirtualMachine::GarbageSchedule 
 VirtualMachine::makeGarbageSchedule(const Program &p) const
 {
-    GarbageSchedule freeProg;
+    return makeGarbageSchedule(p, 0);
+}
+
+VirtualMachine::GarbageSchedule 
+VirtualMachine::makeGarbageSchedule(const Program &p, const unsigned int start) const
+{
+    const unsigned int nObj = env().getMaxAddress();
+    GarbageSchedule    freeProg;
+    std::vector<int>   pos(module_.size(), -1), last(nObj, -1), time(nObj, -1);
     
     freeProg.resize(p.size());
+    for (unsigned int i = 0; i < p.size(); ++i)
+    {
+        pos[p[i]] = i;
+    }
 
-    // earliest time to destroy object ignoring dependencies
-    std::function<unsigned int(const unsigned int)> earliestTimeNoDep = 
-    [&](const unsigned int a)
+    // earliest time to destroy object ignoring dependencies: last step of 
+    // the program using (as an input or a shared object) or creating it
+    for (unsigned int m = 0; m < module_.size(); ++m)
     {
-        
-        auto pred = [a, this](const unsigned int b)
+        for (auto a: module_[m].input)
+        {
+            last[a] = std::max(last[a], pos[m]);
+        }
+        for (auto a: module_[m].shared)
         {
-            auto &in = module_[b].input;
-            auto it  = std::find(in.begin(), in.end(), a);
-            
-            return (it != in.end()) or (b == env().getObjectModule(a));
-        };
-        auto it = std::find_if(p.rbegin(), p.rend(), pred);
-        assert(it != p.rend());
+            last[a] = std::max(last[a], pos[m]);
+        }
+    }
+    for (unsigned int a = 0; a < nObj; ++a)
+    {
+        int m = env().getObjectModule(a);
 
-        return std::distance(it, p.rend()) - 1;
-    };
+        if (m >= 0)
+        {
+            last[a] = std::max(last[a], pos[m]);
+        }
+    }
 
     // earliest time to destroy object (taking dependencies into account)
-    std::function<unsigned int(const unsigned int)> earliestTime = 
+    std::function<int(const unsigned int)> earliestTime = 
     [&](const unsigned int a)
     {
-        unsigned int t = 0;
-
-        t = std::max(t, earliestTimeNoDep(a));
-        for (auto &d: env().getObjectDependencies(a))
+        if (time[a] < 0)
         {
-            t = std::max(t, earliestTime(d));
+            int t = last[a];
+
+            for (auto &d: env().getObjectDependencies(a))
+            {
+                t = std::max(t, earliestTime(d));
+            }
+            time[a] = t;
         }
 
-        return t;
+        return time[a];
     };
 
-    for (unsigned int a = 0; a < env().getMaxAddress(); ++a)
+    for (unsigned int a = 0; a < nObj; ++a)
     {
         if (env().getObjectStorage(a) == Environment::Storage::standard)
         {
-            freeProg[earliestTime(a)].insert(a);
+            int t = earliestTime(a);
+
+            // objects only involved in modules absent from the program (e.g.
+            // skipped when resuming) are never created and have nothing to free
+            if (t < 0)
+            {
+                continue;
+            }
+            if (t >= static_cast<int>(start))
+            {
+                freeProg[t].insert(a);
+            }
         }
     }
 
@@ -832,11 +1011,36 @@ VirtualMachine::makeGarbageSchedule(const Program &p) const
 // high-water memory function //////////////////////////////////////////////////
 VirtualMachine::Size VirtualMachine::memoryNeeded(const Program &p)
 {
+    std::vector<Size> peak;
+
+    return memoryNeeded(p, peak, nullptr, 0);
+}
+
+VirtualMachine::Size VirtualMachine::memoryNeeded(const Program &p, 
+                                                  std::vector<Size> &peak,
+                                                  const std::vector<Size> *parent,
+                                                  const unsigned int prefix)
+{
+    // the first steps of a program sharing a prefix with its parent allocate
+    // and destroy the same objects, only the rest of the program is evaluated
     const MemoryProfile &profile = getMemoryProfile();
-    GarbageSchedule     freep    = makeGarbageSchedule(p);
+    unsigned int        start    = 0;
     Size                current = 0, max = 0;
 
-    for (unsigned int i = 0; i < p.size(); ++i)
+    if (parent and (prefix > 0) and (2*prefix <= parent->size()))
+    {
+        start = prefix;
+    }
+    GarbageSchedule freep = makeGarbageSchedule(p, start);
+
+    peak.resize(2*p.size());
+    if (start > 0)
+    {
+        std::copy(parent->begin(), parent->begin() + 2*start, peak.begin());
+        max     = peak[2*start - 2];
+        current = peak[2*start - 1];
+    }
+    for (unsigned int i = start; i < p.size(); ++i)
     {
         for (auto &o: profile.module[p[i]])
         {
@@ -847,6 +1051,8 @@ VirtualMachine::Size VirtualMachine::memoryNeeded(const Program &p)
         {
             current -= profile.object[o].size;
         }
+        peak[2*i]     = max;
+        peak[2*i + 1] = current;
     }
 
     return max;
@@ -875,9 +1081,14 @@ VirtualMachine::Program VirtualMachine::schedule(const GeneticPar &par)
     gpar.mutationRate = par.mutationRate;
     gpar.seed         = rd();
     CartesianCommunicator::BroadcastWorld(0, &(gpar.seed), sizeof(gpar.seed));
-    Scheduler::ObjFunc memPeak = [this](const Program &p)->Size
+    // the memory profile is computed before the parallel evaluations
+    getMemoryProfile();
+    Scheduler::IncObjFunc memPeak = [this](Scheduler::Profile &peak, 
+                                           const Program &p,
+                                           const Scheduler::Profile *parent,
+                                           const unsigned int prefix)->Size
     {
-        return memoryNeeded(p);
+        return memoryNeeded(p, peak, parent, prefix);
     };
     Scheduler scheduler(graph, memPeak, gpar);
     gen = 0;
@@ -963,16 +1174,297 @@ VirtualMachine::Program VirtualMachine::naiveSchedule(void)
     return p;
 }
 
+// critical-path scheduler /////////////////////////////////////////////////////
+// List scheduling: among the modules whose dependencies are executed, the one
+// with the longest remaining path (in estimated time) to the end of the 
+// program is executed first, so that long chains (e.g. loads followed by 
+// solves) start as early as possible. A module is only chosen if the live
+// memory after its setup fits in the budget, otherwise the module with the 
+// smallest memory footprint is executed.
+VirtualMachine::Program VirtualMachine::criticalPathSchedule(const Size budget)
+{
+    const MemoryProfile                 &profile = getMemoryProfile();
+    const unsigned int                  nMod = module_.size(), nObj = env().getMaxAddress();
+    std::vector<double>                 cost = dbModuleTimes(), level(nMod, 0.);
+    std::vector<std::set<unsigned int>> child(nMod);
+    std::vector<unsigned int>           nParent(nMod, 0), nUser(nObj, 0), order;
+    std::vector<Size>                   alloc(nMod, 0);
+    std::set<unsigned int>              ready;
+    Size                                current = 0;
+    Program                             p;
+
+    LOG(Message) << "Using critical-path scheduler (memory budget "
+                 << ((budget > 0) ? sizeString(budget) : "none") << ")" << std::endl;
+    // dependencies and memory footprints
+    for (unsigned int m = 0; m < nMod; ++m)
+    {
+        for (auto in: module_[m].input)
+        {
+            int parent = env().getObjectModule(in);
+
+            if (parent >= 0)
+            {
+                child[parent].insert(m);
+            }
+            nUser[in]++;
+        }
+        for (auto &o: profile.module[m])
+        {
+            alloc[m] += o.second;
+        }
+    }
+    for (unsigned int m = 0; m < nMod; ++m)
+    for (auto c: child[m])
+    {
+        nParent[c]++;
+    }
+    // longest path to the end of the program, in reverse topological order
+    std::vector<unsigned int> np = nParent;
+
+    for (unsigned int m = 0; m < nMod; ++m)
+    {
+        if (np[m] == 0)
+        {
+            order.push_back(m);
+        }
+    }
+    for (unsigned int i = 0; i < order.size(); ++i)
+    for (auto c: child[order[i]])
+    {
+        if (--np[c] == 0)
+        {
+            order.push_back(c);
+        }
+    }
+    if (order.size() != nMod)
+    {
+        HADRONS_ERROR(Range, "cycle in module graph");
+    }
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        double l = 0.;
+
+        for (auto c: child[*it])
+        {
+            l = std::max(l, level[c]);
+        }
+        level[*it] = cost[*it] + l;
+    }
+    // list scheduling
+    for (unsigned int m = 0; m < nMod; ++m)
+    {
+        if (nParent[m] == 0)
+        {
+            ready.insert(m);
+        }
+    }
+    while (!ready.empty())
+    {
+        int best = -1, smallest = -1;
+
+        for (auto m: ready)
+        {
+            if ((budget == 0) or (current + alloc[m] <= budget))
+            {
+                if ((best < 0) or (level[m] > level[best]))
+                {
+                    best = m;
+                }
+            }
+            if ((smallest < 0) or (alloc[m] < alloc[smallest]))
+            {
+                smallest = m;
+            }
+        }
+        if (best < 0)
+        {
+            best = smallest;
+        }
+        p.push_back(best);
+        ready.erase(best);
+        // live memory: temporaries and objects without remaining users are
+        // freed after the module execution
+        current += alloc[best];
+        for (auto &o: profile.module[best])
+        {
+            if ((profile.object[o.first].storage == Environment::Storage::temporary)
+                or ((profile.object[o.first].storage == Environment::Storage::standard)
+                    and (nUser[o.first] == 0)))
+            {
+                current -= o.second;
+            }
+        }
+        for (auto in: module_[best].input)
+        {
+            if ((--nUser[in] == 0) and (profile.object[in].storage == Environment::Storage::standard))
+            {
+                current -= profile.object[in].size;
+            }
+        }
+        for (auto c: child[best])
+        {
+            if (--nParent[c] == 0)
+            {
+                ready.insert(c);
+            }
+        }
+    }
+    makeTimeline(p, cost);
+    if (hasDatabase() and makeScheduleDb_)
+    {
+        for (unsigned int i = 0; i < p.size(); ++i)
+        {
+            ScheduleEntry s;
+
+            s.step     = i;
+            s.moduleId = p[i];
+            db_->insert("schedule", s);
+        }
+    }
+
+    return p;
+}
+
+// module timings from previous runs, in seconds (modules never timed are 
+// given the average time of the others, or 1 s if no timing is available)
+std::vector<double> VirtualMachine::dbModuleTimes(void)
+{
+    std::vector<double> time(getNModule(), -1.);
+    double              sum = 0.;
+    unsigned int        n = 0;
+
+    if (hasDatabase())
+    {
+        for (auto &e: db_->getTable<ModuleTimeEntry>("moduleTimes"))
+        {
+            if (hasModule(e.module))
+            {
+                time[getModuleAddress(e.module)] = e.time;
+                sum += e.time;
+                n++;
+            }
+        }
+    }
+    LOG(Message) << "Timings from previous runs available for " << n << "/"
+                 << getNModule() << " module(s)" << std::endl;
+    for (auto &t: time)
+    {
+        if (t < 0.)
+        {
+            t = (n > 0) ? sum/n : 1.;
+        }
+    }
+
+    return time;
+}
+
+// module timings are averaged over all the measured trajectories
+void VirtualMachine::dbUpdateModuleTimes(void)
+{
+    if (hasDatabase())
+    {
+        std::map<std::string, ModuleTimeEntry> entry;
+
+        for (auto &e: db_->getTable<ModuleTimeEntry>("moduleTimes"))
+        {
+            entry[e.module] = e;
+        }
+        for (auto &t: moduleTimeProfile_)
+        {
+            double sec = std::chrono::duration<double>(t.second).count();
+            auto   it  = entry.find(t.first);
+
+            if (it == entry.end())
+            {
+                ModuleTimeEntry e;
+
+                e.module = t.first;
+                e.time   = sec;
+                e.count  = 1;
+                db_->insert("moduleTimes", e);
+            }
+            else
+            {
+                ModuleTimeEntry &e = it->second;
+
+                e.time = (e.time*e.count + sec)/(e.count + 1);
+                e.count++;
+                db_->insert("moduleTimes", e, true);
+            }
+        }
+    }
+}
+
+// predicted timeline, stored to be compared with the measured timings
+void VirtualMachine::makeTimeline(const Program &p, const std::vector<double> &cost)
+{
+    std::vector<Size> peak;
+    double            t   = 0.;
+    Size              max = memoryNeeded(p, peak, nullptr, 0);
+
+    predictedTime_.clear();
+    if (hasDatabase())
+    {
+        if (db_->tableExists("timeline"))
+        {
+            db_->execute("DELETE FROM timeline;");
+        }
+        else
+        {
+            db_->createTable<TimelineEntry>("timeline", "PRIMARY KEY(step)");
+        }
+    }
+    LOG(Message) << "Predicted timeline:" << std::endl;
+    for (unsigned int i = 0; i < p.size(); ++i)
+    {
+        TimelineEntry e;
+
+        e.step   = i;
+        e.module = module_[p[i]].name;
+        e.start  = t;
+        e.end    = t + cost[p[i]];
+        e.memory = peak[2*i];
+        t        = e.end;
+        predictedTime_[e.module] = cost[p[i]];
+        LOG(Message) << std::setw(4) << i + 1 << ": " << std::setw(12) 
+                     << e.start << " s -> " << std::setw(12) << e.end << " s " << e.module << " (peak "
+                     << sizeString(e.memory) << ")" << std::endl;
+        if (hasDatabase())
+        {
+            db_->insert("timeline", e);
+        }
+    }
+    LOG(Message) << "Predicted total time: " << t << " s, peak memory: " 
+                 << sizeString(max) << std::endl;
+}
+
 // general execution ///////////////////////////////////////////////////////////
 #define BIG_SEP   "================"
 #define SEP       "----------------"
 #define SMALL_SEP "................"
 
-void VirtualMachine::executeProgram(const Program &p)
+void VirtualMachine::executeProgram(const Program &program)
 {
     Size            memPeak = 0, sizeBefore, sizeAfter;
     GarbageSchedule freeProg;
+    Program         p = program;
     
+    // skip completed modules when resuming
+    if (resume_)
+    {
+        p = dbResumeProgram(program);
+        if (p.empty())
+        {
+            LOG(Message) << "Trajectory " << traj_ << " already completed" << std::endl;
+
+            return;
+        }
+        else if (p.size() < program.size())
+        {
+            LOG(Message) << "Resuming trajectory " << traj_ << ": " << p.size() 
+                         << "/" << program.size() << " step(s) to run" << std::endl;
+        }
+    }
     // build garbage collection schedule
     LOG(Debug) << "Building garbage collection schedule..." << std::endl;
     freeProg = makeGarbageSchedule(p);
@@ -1003,6 +1495,10 @@ void VirtualMachine::executeProgram(const Program &p)
         currentModule_ = p[i];
         (*module_[p[i]].data)();
         currentModule_ = -1;
+        if (resume_)
+        {
+            dbCheckpoint(p[i]);
+        }
         sizeBefore = env().getTotalSize();
         // print time profile after execution
         LOG(Message) << SMALL_SEP << " Timings" << std::endl;
@@ -1071,6 +1567,24 @@ void VirtualMachine::executeProgram(const Program &p)
     printTimeProfile(moduleTimeProfile_, totalTime_);
     LOG(Message) << SMALL_SEP << " Module type breakdown" << std::endl;
     printTimeProfile(moduleTypeTimeProfile_, totalTime_);
+    if (!predictedTime_.empty())
+    {
+        LOG(Message) << SMALL_SEP << " Predicted vs. measured" << std::endl;
+        LOG(Message) << std::setw(14) << "predicted" << std::setw(14) 
+                     << "measured" << " module" << std::endl;
+        for (auto &t: moduleTimeProfile_)
+        {
+            auto it = predictedTime_.find(t.first);
+
+            if (it != predictedTime_.end())
+            {
+                LOG(Message) << std::setw(12) << it->second << " s " << std::setw(12)
+                             << std::chrono::duration<double>(t.second).count()
+                             << " s " << t.first << std::endl;
+            }
+        }
+    }
+    dbUpdateModuleTimes();
 }
 
 void VirtualMachine::executeProgram(const std::vector<std::string> &p)
@@ -124,13 +124,42 @@ public:
         HADRONS_SQL_FIELDS(SqlUnique<SqlNotNull<unsigned int>>, step,
                            SqlUnique<SqlNotNull<unsigned int>>, moduleId);
     };
+
+    struct ModuleTimeEntry: SqlEntry
+    {
+        HADRONS_SQL_FIELDS(SqlUnique<SqlNotNull<std::string>>, module,
+                           SqlNotNull<double>                , time,
+                           SqlNotNull<unsigned int>          , count);
+    };
+
+    struct TimelineEntry: SqlEntry
+    {
+        HADRONS_SQL_FIELDS(SqlUnique<SqlNotNull<unsigned int>>, step,
+                           SqlNotNull<std::string>            , module,
+                           SqlNotNull<double>                 , start,
+                           SqlNotNull<double>                 , end,
+                           SqlNotNull<SITE_SIZE_TYPE>         , memory);
+    };
+
+    struct CheckpointEntry: SqlEntry
+    {
+        HADRONS_SQL_FIELDS(SqlNotNull<unsigned int>, traj,
+                           SqlNotNull<std::string> , module);
+    };
+
+    struct CheckpointFileEntry: SqlEntry
+    {
+        HADRONS_SQL_FIELDS(SqlNotNull<unsigned int>, traj,
+                           SqlNotNull<std::string> , module,
+                           SqlNotNull<std::string> , filename);
+    };
 private:
     struct ModuleInfo
     {
         const std::type_info      *type{nullptr};
         std::string               name;
         ModPt                     data{nullptr};
-        std::vector<unsigned int> input, output;
+        std::vector<unsigned int> input, output, shared;
         size_t                    maxAllocated;
     };
 public:
@@ -145,6 +174,9 @@ public:
     void                dbRestoreMemoryProfile(void);
     void                dbRestoreModules(void);
     Program             dbRestoreSchedule(void);
+    // checkpoint/resume of programs (needs a database)
+    void                setResume(const bool resume);
+    bool                getResume(void) const;
     // module management
     void                pushModule(ModPt &pt);
     template <typename M>
@@ -166,6 +198,10 @@ public:
     unsigned int        getModuleAddress(const std::string name) const;
     std::string         getModuleName(const unsigned int address) const;
     std::string         getModuleType(const unsigned int address) const;
+    // objects used by several modules without ordering constraint (e.g. 
+    // momentum phases), freed after the last user in the program
+    void                addSharedObjectUser(const unsigned int objAddress,
+                                            const unsigned int moduleAddress);
     std::string         getModuleType(const std::string name) const;
     std::string         getModuleNamespace(const unsigned int address) const;
     std::string         getModuleNamespace(const std::string name) const;
@@ -187,10 +223,20 @@ public:
     GarbageSchedule     makeGarbageSchedule(const Program &p) const;
     // high-water memory function
     Size                memoryNeeded(const Program &p);
+    // incremental high-water memory function: peak is filled with the running
+    // high-water mark and memory after each step, the first prefix steps are
+    // taken from parent if not null (thread-safe once the memory profile is
+    // computed)
+    Size                memoryNeeded(const Program &p, std::vector<Size> &peak,
+                                     const std::vector<Size> *parent,
+                                     const unsigned int prefix);
     // genetic scheduler
     Program             schedule(const GeneticPar &par);
     // naive scheduler
     Program             naiveSchedule(void);
+    // critical-path scheduler, using module timings from previous runs and 
+    // keeping the memory under budget when possible (no limit if 0)
+    Program             criticalPathSchedule(const Size budget = 0);
     // general execution
     void                executeProgram(const Program &p);
     void                executeProgram(const std::vector<std::string> &p);
@@ -201,6 +247,9 @@ private:
     DEFINE_ENV_ALIAS;
     // module graph
     void makeModuleGraph(void);
+    // garbage collection, objects destroyed before start are omitted
+    GarbageSchedule makeGarbageSchedule(const Program &p, 
+                                        const unsigned int start) const;
     // memory profile
     void makeMemoryProfile(void);
     void resetProfile(void);
@@ -214,6 +263,14 @@ private:
     void         initDatabase(void);
     unsigned int dbInsertModuleType(const std::string type);
     unsigned int dbInsertObjectType(const std::string type, const std::string baseType);
+    // module timings from previous runs
+    std::vector<double> dbModuleTimes(void);
+    void                dbUpdateModuleTimes(void);
+    // predicted timeline of a program
+    void                makeTimeline(const Program &p, const std::vector<double> &cost);
+    // checkpoint handling
+    void         dbCheckpoint(const unsigned int address);
+    Program      dbResumeProgram(const Program &p);
 private:
     // general
     std::string                         runId_;
@@ -221,6 +278,7 @@ private:
     // database
     Database                            *db_{nullptr};
     bool                                makeModuleDb_{true}, makeObjectDb_{true}, makeScheduleDb_{true};
+    bool                                resume_{false};
     // module and related maps
     std::vector<ModuleInfo>             module_;
     std::map<std::string, unsigned int> moduleAddress_;
@@ -234,6 +292,7 @@ private:
     // time profile
     GridTime                            totalTime_;
     std::map<std::string, GridTime>     moduleTimeProfile_, moduleTypeTimeProfile_;               
+    std::map<std::string, double>       predictedTime_;
 };
 
 /******************************************************************************
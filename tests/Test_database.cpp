@@ -174,6 +174,13 @@ int main(int argc, char *argv[])
         LOG(Message) << s << std::endl;
     }
 
+    // strings with single quotes are escaped
+    entry.msg = "it's 'quoted'";
+    db.insert("test2", entry);
+    auto quoted = db.getTable<TestEntry>("test2", "WHERE msg = '" 
+                                         + SqlEntry::sqlEscape(entry.msg) + "'");
+    assert((quoted.size() == 1) and (quoted[0].msg == entry.msg));
+
     LOG(Message) << "Table 'test' exists: " << db.tableExists("test") << std::endl;
     LOG(Message) << "Table 'foo' exists : " << db.tableExists("foo")  << std::endl;
 
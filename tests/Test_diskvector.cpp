@@ -108,6 +108,62 @@ int main(int argc, char *argv[])
                  << ((m == n) ? "yes" : "no" ) << std::endl;
     LOG(Message) << "hit ratio " << w.hitRatio() << std::endl;
 
+    // eviction policy benchmark on a Contractor-like access trace:
+    // tr(A[t0 + dt]*B[t1 + dt]*C[t2 + dt]) for all times and translations,
+    // all terms read from the same vector
+    const unsigned int        nt = 32, nMode = 200, cacheSize = 6;
+    std::vector<unsigned int> times = {0, 4, 8, 12}, trace;
+
+    for (auto t0: times)
+    for (auto t1: times)
+    for (unsigned int dt = 0; dt < nt; ++dt)
+    {
+        trace.push_back((t0 + dt) % nt);
+        trace.push_back((t1 + dt) % nt);
+        trace.push_back((t0 + t1 + dt) % nt);
+    }
+    std::map<DiskVectorPolicy, double> hitRatio;
+
+    for (DiskVectorPolicy policy: std::vector<DiskVectorPolicy>{DiskVectorPolicy::lru,
+                                                                DiskVectorPolicy::lfu, 
+                                                                DiskVectorPolicy::belady})
+    {
+        std::string                     dir = "diskvector_policy_test_" 
+                                              + std::to_string(static_cast<int>(policy));
+        EigenDiskVector<ComplexD>       u(dir, nt, cacheSize);
+        const EigenDiskVector<ComplexD> &cu = u;
+        double                          t;
+
+        for (unsigned int i = 0; i < nt; ++i)
+        {
+            u[i] = EigenDiskVectorMat<ComplexD>::Random(nMode, nMode);
+        }
+        u.setPolicy(policy);
+        u.resetStat();
+        if (policy == DiskVectorPolicy::belady)
+        {
+            u.prefetch(trace, 0);
+        }
+        t = -usecond();
+        for (auto i: trace)
+        {
+            cu[i];
+        }
+        t += usecond();
+        hitRatio[policy] = u.hitRatio();
+        LOG(Message) << "policy " << policy << ": hit ratio " << hitRatio[policy]
+                     << ", " << trace.size() << " accesses in " << t/1.0e6
+                     << " sec (load " << u.loadTime()/1.0e6 << " sec)" << std::endl;
+    }
+    // Belady's policy is optimal for a known trace
+    if (hitRatio[DiskVectorPolicy::belady] < hitRatio[DiskVectorPolicy::lru])
+    {
+        LOG(Error) << "belady hit ratio lower than LRU" << std::endl;
+        Grid_finalize();
+
+        return EXIT_FAILURE;
+    }
+
     Grid_finalize();
     
     return EXIT_SUCCESS;
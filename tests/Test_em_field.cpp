@@ -127,6 +127,19 @@ int main(int argc, char *argv[])
     emGen(a, rng, w, &EmFieldGenerator::transverseProjectSpatial);
     check(photonA, a);
 
+    LOG(Message) << "============ Regressing batched Coulomb QEDL against single fields" << std::endl;
+    std::vector<EmFieldGenerator::GaugeField> batch(3, grid);
+    emGen.makeWeightsQedL(w);
+    emGen.makeSqrtWeight(v, w);
+    rng.SeedUniqueString("qed-test-gauge-1000");
+    emGen.generate(batch, rng, v, &EmFieldGenerator::transverseProjectSpatial);
+    rng.SeedUniqueString("qed-test-gauge-1000");
+    for (auto &b: batch)
+    {
+        emGen.generate(a, rng, v, &EmFieldGenerator::transverseProjectSpatial);
+        check(b, a);
+    }
+
     LOG(Message) << "============ Regressing Feynman weights QEDZeta against QEDL" << std::endl;
     rng.SeedUniqueString("qed-test-gauge-1000");
     double zeta = 0.42, zmn2 = 0.;
@@ -0,0 +1,109 @@
+/*
+ * Test_point_sink.cpp, part of Hadrons (https://github.com/aportelli/Hadrons)
+ *
+ * Copyright (C) 2015 - 2023
+ *
+ * Author: Antonin Portelli <antonin.portelli@me.com>
+ *
+ * Hadrons is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Hadrons is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hadrons.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See the full license in the file "LICENSE" in the top level distribution 
+ * directory.
+ */
+
+/*  END LEGAL */
+
+#include <Hadrons/Application.hpp>
+#include <Hadrons/Modules.hpp>
+
+using namespace Grid;
+using namespace Hadrons;
+
+// A momentum point sink is only a function object referring to a shared
+// momentum phase, it is evaluated later by the contractions using it. This test
+// checks that the phase is kept alive until the last contraction using the sink.
+int main(int argc, char *argv[])
+{
+    // initialization //////////////////////////////////////////////////////////
+    Grid_init(&argc, &argv);
+    HadronsLogError.Active(GridLogError.isActive());
+    HadronsLogWarning.Active(GridLogWarning.isActive());
+    HadronsLogMessage.Active(GridLogMessage.isActive());
+    HadronsLogIterative.Active(GridLogIterative.isActive());
+    HadronsLogDebug.Active(GridLogDebug.isActive());
+    LOG(Message) << "Grid initialized" << std::endl;
+
+    // run setup ///////////////////////////////////////////////////////////////
+    Application              application;
+    std::vector<std::string> mom = {"0 0 0", "1 0 0", "1 1 0"};
+    std::string              boundary = "1 1 1 -1";
+
+    // global parameters
+    Application::GlobalPar globalPar;
+    globalPar.trajCounter.start = 1500;
+    globalPar.trajCounter.end   = 1520;
+    globalPar.trajCounter.step  = 20;
+    globalPar.runId             = "test";
+    application.setPar(globalPar);
+    // gauge field
+    application.createModule<MGauge::Unit>("gauge");
+    // sinks, created before anything else uses them
+    for (unsigned int i = 0; i < mom.size(); ++i)
+    {
+        MSink::Point::Par sinkPar;
+
+        sinkPar.mom = mom[i];
+        application.createModule<MSink::ScalarPoint>("sink_" + std::to_string(i), sinkPar);
+    }
+    // point source
+    MSource::Point::Par ptPar;
+    ptPar.position = "0 0 0 0";
+    application.createModule<MSource::Point>("pt", ptPar);
+    // free Wilson propagator
+    MAction::Wilson::Par actionPar;
+    actionPar.gauge    = "gauge";
+    actionPar.mass     = 0.1;
+    actionPar.boundary = boundary;
+    application.createModule<MAction::Wilson>("W", actionPar);
+    MFermion::FreeProp::Par freePar;
+    freePar.source   = "pt";
+    freePar.action   = "W";
+    freePar.twist    = "0 0 0 0";
+    freePar.boundary = boundary;
+    freePar.mass     = actionPar.mass;
+    application.createModule<MFermion::FreeProp>("Q", freePar);
+    // contractions, each sink is used twice after the propagator is computed
+    for (unsigned int i = 0; i < mom.size(); ++i)
+    for (unsigned int j = 0; j < 2; ++j)
+    {
+        MContraction::Meson::Par mesPar;
+        std::string              name = "meson_" + std::to_string(i) + "_" + std::to_string(j);
+
+        mesPar.output = "mesons/" + name;
+        mesPar.q1     = "Q";
+        mesPar.q2     = "Q";
+        mesPar.gammas = (j == 0) ? "(Gamma5 Gamma5)" : "(GammaT GammaT)";
+        mesPar.sink   = "sink_" + std::to_string(i);
+        application.createModule<MContraction::Meson>(name, mesPar);
+    }
+
+    // execution
+    application.run();
+
+    // epilogue
+    LOG(Message) << "Grid is finalizing now" << std::endl;
+    Grid_finalize();
+
+    return EXIT_SUCCESS;
+}
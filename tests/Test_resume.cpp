@@ -0,0 +1,127 @@
+/*
+ * Test_resume.cpp, part of Hadrons (https://github.com/aportelli/Hadrons)
+ *
+ * Copyright (C) 2015 - 2023
+ *
+ * Author: Antonin Portelli <antonin.portelli@me.com>
+ *
+ * Hadrons is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Hadrons is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hadrons.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * See the full license in the file "LICENSE" in the top level distribution 
+ * directory.
+ */
+
+/*  END LEGAL */
+
+#include <Hadrons/Application.hpp>
+#include <Hadrons/Modules.hpp>
+
+using namespace Grid;
+using namespace Hadrons;
+
+// Resumes a trajectory for which some modules are already checkpointed in the
+// application database. The checkpointed contraction and the sink only it uses
+// are skipped, so their objects are never created in the resumed run.
+int main(int argc, char *argv[])
+{
+    // initialization //////////////////////////////////////////////////////////
+    Grid_init(&argc, &argv);
+    HadronsLogError.Active(GridLogError.isActive());
+    HadronsLogWarning.Active(GridLogWarning.isActive());
+    HadronsLogMessage.Active(GridLogMessage.isActive());
+    HadronsLogIterative.Active(GridLogIterative.isActive());
+    HadronsLogDebug.Active(GridLogDebug.isActive());
+    LOG(Message) << "Grid initialized" << std::endl;
+
+    // partial checkpoint //////////////////////////////////////////////////////
+    std::string  dbFilename = "resumeApp.db";
+    unsigned int traj       = 1500;
+    GridBase     *grid      = Environment::getInstance().getGrid();
+
+    if (grid->IsBoss())
+    {
+        remove(dbFilename.c_str());
+
+        Database                         db(dbFilename);
+        VirtualMachine::CheckpointEntry  e;
+
+        db.createTable<VirtualMachine::CheckpointEntry>("checkpoint", "PRIMARY KEY(traj, module)");
+        e.traj = traj;
+        for (auto &m: {"sink_done", "meson_done"})
+        {
+            e.module = m;
+            db.insert("checkpoint", e);
+        }
+    }
+    grid->Barrier();
+
+    // run setup ///////////////////////////////////////////////////////////////
+    Application application;
+    std::string boundary = "1 1 1 -1";
+
+    // global parameters
+    Application::GlobalPar globalPar;
+    globalPar.trajCounter.start      = traj;
+    globalPar.trajCounter.end        = traj + 20;
+    globalPar.trajCounter.step       = 20;
+    globalPar.runId                  = "test";
+    globalPar.database.applicationDb = dbFilename;
+    globalPar.database.resume        = true;
+    application.setPar(globalPar);
+    // gauge field
+    application.createModule<MGauge::Unit>("gauge");
+    // sinks
+    MSink::Point::Par sinkPar;
+    sinkPar.mom = "1 0 0";
+    application.createModule<MSink::ScalarPoint>("sink_done", sinkPar);
+    sinkPar.mom = "0 0 0";
+    application.createModule<MSink::ScalarPoint>("sink_todo", sinkPar);
+    // point source
+    MSource::Point::Par ptPar;
+    ptPar.position = "0 0 0 0";
+    application.createModule<MSource::Point>("pt", ptPar);
+    // free Wilson propagator
+    MAction::Wilson::Par actionPar;
+    actionPar.gauge    = "gauge";
+    actionPar.mass     = 0.1;
+    actionPar.boundary = boundary;
+    application.createModule<MAction::Wilson>("W", actionPar);
+    MFermion::FreeProp::Par freePar;
+    freePar.source   = "pt";
+    freePar.action   = "W";
+    freePar.twist    = "0 0 0 0";
+    freePar.boundary = boundary;
+    freePar.mass     = actionPar.mass;
+    application.createModule<MFermion::FreeProp>("Q", freePar);
+    // contractions
+    MContraction::Meson::Par mesPar;
+    mesPar.q1     = "Q";
+    mesPar.q2     = "Q";
+    mesPar.gammas = "(Gamma5 Gamma5)";
+    mesPar.output = "mesons/done";
+    mesPar.sink   = "sink_done";
+    application.createModule<MContraction::Meson>("meson_done", mesPar);
+    mesPar.output = "mesons/todo";
+    mesPar.sink   = "sink_todo";
+    application.createModule<MContraction::Meson>("meson_todo", mesPar);
+
+    // execution
+    application.run();
+
+    // epilogue
+    LOG(Message) << "Grid is finalizing now" << std::endl;
+    Grid_finalize();
+
+    return EXIT_SUCCESS;
+}
@@ -47,6 +47,8 @@ void ProjAccumRunner(std::vector<Field> &in, std::vector<Field> &out, unsigned i
 
     GridStopWatch w1;
     GridTime ProjAccum = GridTime::zero();
+    BatchDeflationUtils::ProjStat stat;
+    bool check = true;
 
     LOG(Message) << "ProjAccumRunner start" << std::endl;
     
@@ -76,17 +78,51 @@ void ProjAccumRunner(std::vector<Field> &in, std::vector<Field> &out, unsigned i
 
             LOG(Message) << "srcBlockSize: " << srcBlockSize << std::endl;
 
+            // check the blocked kernel against the reference on the first call
+            if (check)
+            {
+                std::vector<Field> ref(out.begin(), out.end()), res(out.begin(), out.end());
+                RealD              diff = 0., norm = 0.;
+                const RealD        tol  = (sizeof(typename Field::scalar_type) == sizeof(ComplexF)) 
+                                          ? 1.0e-5 : 1.0e-12;
+
+                BatchDeflationUtils::projAccumulateReference(in, ref, Epack.evec, Epack.eval,
+                                                             0, evBlockSize, j, j + srcBlockSize);
+                BatchDeflationUtils::projAccumulate(in, res, Epack.evec, Epack.eval,
+                                                    0, evBlockSize, j, j + srcBlockSize);
+                for (unsigned int k = j; k < j + srcBlockSize; ++k)
+                {
+                    diff += norm2(res[k] - ref[k]);
+                    norm += norm2(ref[k]);
+                }
+                diff = std::sqrt(diff/norm);
+                LOG(Message) << "Relative difference with reference: " 
+                             << diff << " (tolerance " << tol << ")" << std::endl;
+                if (!(diff <= tol))
+                {
+                    HADRONS_ERROR(Logic, "blocked projection differs from the reference (relative difference "
+                                  + std::to_string(diff) + ")");
+                }
+                check = false;
+            }
             w1.Start();
             BatchDeflationUtils::projAccumulate(in, out, Epack.evec, Epack.eval,
-                                                0, evBlockSize, j, j + srcBlockSize);
+                                                0, evBlockSize, j, j + srcBlockSize,
+                                                &stat);
             w1.Stop();
             ProjAccum += w1.Elapsed();
             w1.Reset();
         }
     }
 
+    double t = stat.overlapTime + stat.guessTime;
+
     LOG(Message) << "ProjAccumRunner end" << std::endl;
     LOG(Message) << "ProjAccum total: " << ProjAccum << std::endl;
+    LOG(Message) << "ProjAccum overlap " << stat.overlapTime << " us | guess " 
+                 << stat.guessTime << " us | " << stat.bytes/1024./1024./1024. 
+                 << " GB | " << stat.bytes/1024./1024./1024./t*1.0e6 << " GB/s | "
+                 << stat.flops/t*1.0e-3 << " GFlop/s" << std::endl;
 
 }
 
@@ -34,6 +34,41 @@ using namespace Hadrons;
 
 #define TIME_MOD(t) (((t) + par.global.nt) % par.global.nt)
 
+// number of disk vector elements loaded ahead of the contraction
+#ifndef CONTRACTOR_PREFETCH_DEPTH
+#define CONTRACTOR_PREFETCH_DEPTH 2
+#endif
+
+// number of translations contracted together in a batched product
+#ifndef CONTRACTOR_BATCH_SIZE
+#define CONTRACTOR_BATCH_SIZE 16u
+#endif
+
+// memory budget for the work matrices of a batch (in MB), each translation of a
+// batch needs 3 matrices and the batch is made smaller if they do not fit
+#ifndef CONTRACTOR_BATCH_BUDGET
+#define CONTRACTOR_BATCH_BUDGET 2048
+#endif
+
+// memory budget for the memo of partial products (in MB)
+#ifndef CONTRACTOR_MEMO_BUDGET
+#define CONTRACTOR_MEMO_BUDGET 4096
+#endif
+
+#ifdef GRID_COMMS_MPI3
+#define GET_RANK(rank, nMpi) \
+MPI_Comm_size(MPI_COMM_WORLD, &(nMpi));\
+MPI_Comm_rank(MPI_COMM_WORLD, &(rank));\
+assert(rank<nMpi)
+
+#define INIT() MPI_Init(NULL, NULL)
+#define FINALIZE() MPI_Finalize()
+#else
+#define GET_RANK(rank, nMpi) (nMpi) = 1; (rank) = 0 ; assert(rank<nMpi)
+#define INIT()
+#define FINALIZE()
+#endif
+
 namespace Contractor
 {
     class TrajRange: Serializable
@@ -142,6 +177,279 @@ void saveCorrelator(const Contractor::CorrelatorResult &result, const std::strin
     write(writer, fileStem, result);
 }
 
+// memo of the partial products A0[t0]*A1[t1]*...*Aj[tj], the products of a
+// contraction form a DAG where time sequences and translations with the same
+// absolute times share their prefixes. Each node is counted with its number
+// of future uses and is only kept while it will be reused, within a memory
+// budget with least-recently-used eviction. The complete products 
+// (j = nTerm - 2) are stored transposed, as computed for the traces.
+class ProductMemo
+{
+public:
+    typedef std::vector<unsigned int> Key;
+public:
+    ProductMemo(const double budget): budget_(budget) {}
+
+    // node key for the prefix of length j + 1
+    static Key key(const std::vector<unsigned int> &t, const unsigned int dt, 
+                   const unsigned int j, const unsigned int nt)
+    {
+        Key k(j + 1);
+
+        for (unsigned int l = 0; l <= j; ++l)
+        {
+            k[l] = (t[l] + dt) % nt;
+        }
+
+        return k;
+    }
+
+    // build the DAG from the sequence of products of this rank
+    void plan(const std::vector<std::vector<unsigned int>> &timeSeq,
+              const std::vector<unsigned int> &translations,
+              const unsigned int nTerm, const unsigned int nt,
+              const unsigned int rank, const unsigned int nMpi)
+    {
+        clear();
+        for (unsigned int i = rank; i < timeSeq.size(); i += nMpi)
+        for (auto &dt: translations)
+        for (unsigned int j = 1; j + 1 < nTerm; ++j)
+        {
+            node_[key(timeSeq[i], dt, j, nt)].uses++;
+        }
+    }
+
+    // replay the contraction loop (batchSize translations at a time) on a 
+    // copy of the plan without computing the products, and return the operand
+    // reads (j, time of term j) it makes in order, operands of memoised 
+    // prefixes are not read. size[j] is the size in bytes of the prefix 
+    // product of length j + 1.
+    std::vector<std::pair<unsigned int, unsigned int>> 
+    reads(const std::vector<std::vector<unsigned int>> &timeSeq,
+          const std::vector<unsigned int> &translations,
+          const unsigned int batchSize,
+          const std::vector<double> &size, const unsigned int nt,
+          const unsigned int rank, const unsigned int nMpi) const
+    {
+        const unsigned int                                 nTerm = size.size() + 1;
+        ProductMemo                                        sim(budget_);
+        A2AMatrix<ComplexD>                                dummy;
+        double                                             flops;
+        std::vector<unsigned int>                          depth(batchSize);
+        std::vector<std::pair<unsigned int, unsigned int>> read;
+
+        sim.plan(timeSeq, translations, nTerm, nt, rank, nMpi);
+        for (unsigned int i = rank; i < timeSeq.size(); i += nMpi)
+        for (unsigned int b = 0; b < translations.size(); b += batchSize)
+        {
+            auto         &t = timeSeq[i];
+            unsigned int nb = std::min(static_cast<unsigned int>(translations.size()) - b,
+                                       batchSize);
+
+            for (unsigned int k = 0; k < nb; ++k)
+            {
+                depth[k] = 0;
+                for (unsigned int j = nTerm - 2; j > 0; --j)
+                {
+                    if (sim.fetch(dummy, flops, key(t, translations[b + k], j, nt)))
+                    {
+                        depth[k] = j;
+                        break;
+                    }
+                }
+                for (unsigned int j = 1; j < depth[k]; ++j)
+                {
+                    sim.skip(key(t, translations[b + k], j, nt));
+                }
+            }
+            for (unsigned int k = 0; k < nb; ++k)
+            {
+                if (depth[k] == 0)
+                {
+                    read.emplace_back(0, (t[0] + translations[b + k]) % nt);
+                }
+            }
+            for (unsigned int j = 1; j + 1 < nTerm; ++j)
+            {
+                for (unsigned int k = 0; k < nb; ++k)
+                {
+                    if (depth[k] < j)
+                    {
+                        read.emplace_back(j, (t[j] + translations[b + k]) % nt);
+                    }
+                }
+                for (unsigned int k = 0; k < nb; ++k)
+                {
+                    if (depth[k] < j)
+                    {
+                        sim.reserve(size[j], key(t, translations[b + k], j, nt));
+                    }
+                }
+            }
+        }
+
+        return read;
+    }
+
+    // get a memoised product, moved out on its last use, returns false if not
+    // available
+    bool fetch(A2AMatrix<ComplexD> &m, double &flops, const Key &k)
+    {
+        auto it = node_.find(k);
+
+        if ((it == node_.end()) or !it->second.cached)
+        {
+            return false;
+        }
+        auto &n = it->second;
+
+        flops = n.flops;
+        n.uses--;
+        nHit_++;
+        if (n.uses == 0)
+        {
+            m = std::move(n.mat);
+            erase(n);
+            node_.erase(it);
+        }
+        else
+        {
+            m = n.mat;
+            lru_.splice(lru_.end(), lru_, n.lruPos);
+        }
+
+        return true;
+    }
+
+    // a product was computed, it is stored if it is reused later
+    void store(const A2AMatrix<ComplexD> &m, const double flops, const Key &k)
+    {
+        if (reserve(m.rows()*m.cols()*sizeof(ComplexD), k))
+        {
+            auto &n = node_.at(k);
+
+            n.mat   = m;
+            n.flops = flops;
+        }
+    }
+
+    // bookkeeping of store, returns true if the product is to be stored
+    bool reserve(const double size, const Key &k)
+    {
+        auto it = node_.find(k);
+
+        if (it == node_.end())
+        {
+            return false;
+        }
+        auto &n = it->second;
+
+        n.uses--;
+        if ((n.uses == 0) or n.cached or (size > budget_))
+        {
+            if (n.uses == 0)
+            {
+                erase(n);
+                node_.erase(it);
+            }
+            return false;
+        }
+        while (memory_ + size > budget_)
+        {
+            auto &victim = node_.at(lru_.front());
+
+            erase(victim);
+        }
+        n.size   = size;
+        n.cached = true;
+        n.lruPos = lru_.insert(lru_.end(), k);
+        memory_ += size;
+        maxMemory_ = std::max(maxMemory_, memory_);
+
+        return true;
+    }
+
+    // a node is bypassed because a deeper product was memoised
+    void skip(const Key &k)
+    {
+        auto it = node_.find(k);
+
+        if ((it != node_.end()) and (--it->second.uses == 0))
+        {
+            erase(it->second);
+            node_.erase(it);
+        }
+    }
+
+    void clear(void)
+    {
+        node_.clear();
+        lru_.clear();
+        memory_ = 0.;
+        maxMemory_ = 0.;
+        nHit_ = 0;
+    }
+
+    unsigned long hits(void) const
+    {
+        return nHit_;
+    }
+
+    double maxMemory(void) const
+    {
+        return maxMemory_;
+    }
+private:
+    struct Node
+    {
+        A2AMatrix<ComplexD>       mat;
+        double                    flops{0.}, size{0.};
+        unsigned int              uses{0};
+        bool                      cached{false};
+        std::list<Key>::iterator  lruPos;
+    };
+private:
+    void erase(Node &n)
+    {
+        if (n.cached)
+        {
+            memory_ -= n.size;
+            lru_.erase(n.lruPos);
+            n.mat.resize(0, 0);
+            n.cached = false;
+        }
+    }
+private:
+    double              budget_, memory_{0.}, maxMemory_{0.};
+    unsigned long       nHit_{0};
+    std::map<Key, Node> node_;
+    std::list<Key>      lru_;
+};
+
+// give the disk vectors the exact access sequence of a product, i.e. the 
+// last term for all times, then the operands actually read by the memoised
+// contraction loop
+void prefetchProduct(std::map<std::string, EigenDiskVector<ComplexD>> &a2aMat,
+                     const std::vector<std::string> &term,
+                     const std::vector<std::pair<unsigned int, unsigned int>> &read,
+                     const unsigned int nt)
+{
+    std::map<std::string, std::vector<unsigned int>> seq;
+
+    for (unsigned int t = 0; t < nt; ++t)
+    {
+        seq[term.back()].push_back(t);
+    }
+    for (auto &r: read)
+    {
+        seq[term[r.first]].push_back(r.second);
+    }
+    for (auto &s: seq)
+    {
+        a2aMat.at(s.first).prefetch(s.second, CONTRACTOR_PREFETCH_DEPTH);
+    }
+}
+
 std::set<unsigned int> parseTimeRange(const std::string str, const unsigned int nt)
 {
     std::regex               rex("([0-9]+)|(([0-9]+)\\.\\.([0-9]+))");
@@ -238,6 +546,7 @@ int main(int argc, char* argv[])
 {
     // parse command line
     std::string   parFilename;
+    int           nMpi, rank;
 
     if (argc != 2)
     {
@@ -247,6 +556,8 @@ int main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
     parFilename = argv[1];
+    INIT();
+    GET_RANK(rank, nMpi);
 
     // parse parameter file
     ContractorPar par;
@@ -261,12 +572,19 @@ int main(int argc, char* argv[])
 
     // create diskvectors
     std::map<std::string, EigenDiskVector<ComplexD>> a2aMat;
+    std::map<std::string, std::pair<unsigned int, unsigned int>> a2aDim;
     //    unsigned int                                     cacheSize;
 
     for (auto &p: par.a2aMatrix)
     {
         std::string dirName = par.global.diskVectorDir + "/" + p.name;
 
+        // ranks contract independent time sequences, each with its own cache
+        if (nMpi > 1)
+        {
+            dirName = par.global.diskVectorDir + "/rank" + std::to_string(rank) + "/" + p.name;
+        }
+
         a2aMat.emplace(p.name, EigenDiskVector<ComplexD>(dirName, par.global.nt, p.cacheSize));
     }
 
@@ -289,6 +607,7 @@ int main(int argc, char* argv[])
             A2AMatrixIo<HADRONS_A2AM_IO_TYPE> a2aIo(filename, p.dataset, par.global.nt);
 
             a2aIo.load(a2aMat.at(p.name), &t);
+            a2aDim[p.name] = std::make_pair(a2aIo.getNi(), a2aIo.getNj());
             std::cout << "Read " << a2aIo.getSize() << " bytes in " << t/1.0e6 
                     << " sec, " << a2aIo.getSize()/t*1.0e6/1024/1024 << " MB/s" << std::endl;
         }
@@ -302,8 +621,16 @@ int main(int argc, char* argv[])
             std::vector<std::set<unsigned int>>    times;
             std::vector<std::vector<unsigned int>> timeSeq;
             std::set<unsigned int>                 translations;
-            std::vector<A2AMatrixTr<ComplexD>>     lastTerm(par.global.nt);
-            A2AMatrix<ComplexD>                    prod, buf, tmp;
+            std::vector<unsigned int>              dtVec;
+            A2AMatrixTr<ComplexD>                  lastTerm;
+            std::vector<A2AMatrix<ComplexD>>       prod, rhs, tmp;
+            A2AMatrix<ComplexD>                    trBuf;
+            std::vector<unsigned int>              depth, active;
+            std::vector<double>                    prodFlops, prefixSize(term.size() - 1);
+            unsigned int                           batchSize;
+            double                                 matSize = 0.;
+            ProductMemo                            memo(CONTRACTOR_MEMO_BUDGET*1024.*1024.);
+            double                                 saved, totalSaved = 0.;
             TimerArray                             tAr;
             double                                 fusec, busec, flops, bytes;
 	    //	    double  tusec;
@@ -338,105 +665,232 @@ int main(int argc, char* argv[])
             result.correlator.resize(par.global.nt, 0.);
 
             translations = parseTimeRange(p.translations, par.global.nt);
+            dtVec.assign(translations.begin(), translations.end());
             makeTimeSeq(timeSeq, times);
             std::cout << timeSeq.size()*translations.size()*(term.size() - 2) << " A*B, "
                     << timeSeq.size()*translations.size()*par.global.nt << " tr(A*B)"
                     << std::endl;
 
-            std::cout << "* Caching transposed last term" << std::endl;
+            for (auto &m: a2aMat)
+            {
+                m.second.resetStat();
+            }
+            for (unsigned int j = 0; j < term.size() - 1; ++j)
+            {
+                prefixSize[j] = static_cast<double>(a2aDim.at(term[0]).first)
+                                *a2aDim.at(term[j]).second*sizeof(ComplexD);
+                matSize       = std::max(matSize, prefixSize[j]);
+            }
+            for (auto &m: term)
+            {
+                matSize = std::max(matSize, static_cast<double>(a2aDim.at(m).first)
+                                            *a2aDim.at(m).second*sizeof(ComplexD));
+            }
+            batchSize = static_cast<unsigned int>(
+                std::max(1., std::min(static_cast<double>(CONTRACTOR_BATCH_SIZE),
+                                      CONTRACTOR_BATCH_BUDGET*1024.*1024./(3.*matSize))));
+            std::cout << "Batches of " << batchSize << " translation(s)" << std::endl;
+            prod.resize(batchSize);
+            rhs.resize(batchSize);
+            tmp.resize(batchSize);
+            depth.resize(batchSize);
+            prodFlops.resize(batchSize);
+            prefetchProduct(a2aMat, term, memo.reads(timeSeq, dtVec, batchSize, prefixSize, 
+                                                     par.global.nt, rank, nMpi),
+                            par.global.nt);
+            memo.plan(timeSeq, dtVec, term.size(), par.global.nt, rank, nMpi);
+            // the column t of lastTerm holds the last term at time t with 
+            // the storage transposed with respect to the products: when 
+            // there are intermediate products they are computed transposed 
+            // and the last term is copied as it is, otherwise it is 
+            // transposed
+            std::cout << "* Caching " << ((term.size() > 2) ? "" : "transposed ") 
+                      << "last term" << std::endl;
             for (unsigned int t = 0; t < par.global.nt; ++t)
             {
                 tAr.startTimer("Disk vector overhead");
                 const A2AMatrix<ComplexD> &ref = a2aMat.at(term.back())[t];
                 tAr.stopTimer("Disk vector overhead");
 
-                tAr.startTimer("Transpose caching");
-                lastTerm[t].resize(ref.rows(), ref.cols());
-                thread_for( j,ref.cols(),{
-                  for (unsigned int i = 0; i < ref.rows(); ++i)
-                  {
-                      lastTerm[t](i, j) = ref(i, j);
-                  }
-		});
-                tAr.stopTimer("Transpose caching");
+                tAr.startTimer("Last term caching");
+                if (t == 0)
+                {
+                    lastTerm.resize(ref.size(), par.global.nt);
+                }
+                if (term.size() > 2)
+                {
+                    Eigen::Map<A2AMatrix<ComplexD>> map(lastTerm.col(t).data(), ref.rows(), ref.cols());
+
+                    map = ref;
+                }
+                else
+                {
+                    Eigen::Map<A2AMatrixTr<ComplexD>> map(lastTerm.col(t).data(), ref.rows(), ref.cols());
+
+                    thread_for( j,ref.cols(),{
+                      for (unsigned int i = 0; i < ref.rows(); ++i)
+                      {
+                          map(i, j) = ref(i, j);
+                      }
+                    });
+                }
+                tAr.stopTimer("Last term caching");
             }
-            bytes = par.global.nt*lastTerm[0].rows()*lastTerm[0].cols()*sizeof(ComplexD);
-            std::cout << Sec(tAr.getDTimer("Transpose caching")) << " " 
-                      << Bytes(bytes, tAr.getDTimer("Transpose caching")) << std::endl;
-            for (unsigned int i = 0; i < timeSeq.size(); ++i)
+            bytes = lastTerm.size()*sizeof(ComplexD);
+            std::cout << Sec(tAr.getDTimer("Last term caching")) << " " 
+                      << Bytes(bytes, tAr.getDTimer("Last term caching")) << std::endl;
+            for (unsigned int i = rank; i < timeSeq.size(); i += nMpi)
             {
-                unsigned int dti = 0;
-                auto         &t = timeSeq[i];
+                auto &t = timeSeq[i];
 
                 result.times = t;
                 for (unsigned int tLast = 0; tLast < par.global.nt; ++tLast)
                 {
                     result.correlator[tLast] = 0.;
                 }
-                for (auto &dt: translations)
+                for (unsigned int b = 0; b < dtVec.size(); b += batchSize)
                 {
-                    std::cout << "* Step " << i*translations.size() + dti + 1
-                            << "/" << timeSeq.size()*translations.size()
-                            << " -- positions= " << t << ", dt= " << dt << std::endl;
+                    unsigned int nb = std::min(static_cast<unsigned int>(dtVec.size()) - b,
+                                               batchSize);
+
+                    std::cout << "* Step " << i*dtVec.size() + b + 1;
+                    if (nb > 1)
+                    {
+                        std::cout << "-" << i*dtVec.size() + b + nb;
+                    }
+                    std::cout << "/" << timeSeq.size()*dtVec.size()
+                              << " -- positions= " << t << ", dt= " << dtVec[b];
+                    if (nb > 1)
+                    {
+                        std::cout << ".." << dtVec[b + nb - 1];
+                    }
+                    std::cout << std::endl;
                     if (term.size() > 2)
                     {
                         std::cout << std::setw(8) << "products";
                     }
                     flops  = 0.;
                     bytes  = 0.;
+                    saved  = 0.;
                     fusec  = tAr.getDTimer("A*B algebra");
                     busec  = tAr.getDTimer("A*B total");
                     tAr.startTimer("Linear algebra");
+                    // start from the deepest memoised prefix
+                    tAr.startTimer("A*B total");
+                    for (unsigned int k = 0; k < nb; ++k)
+                    {
+                        depth[k] = 0;
+                        for (unsigned int j = term.size() - 2; j > 0; --j)
+                        {
+                            if (memo.fetch(prod[k], prodFlops[k], 
+                                           ProductMemo::key(t, dtVec[b + k], j, par.global.nt)))
+                            {
+                                depth[k] = j;
+                                saved   += prodFlops[k];
+                                break;
+                            }
+                        }
+                        for (unsigned int j = 1; j < depth[k]; ++j)
+                        {
+                            memo.skip(ProductMemo::key(t, dtVec[b + k], j, par.global.nt));
+                        }
+                    }
+                    tAr.stopTimer("A*B total");
                     tAr.startTimer("Disk vector overhead");
-                    prod = a2aMat.at(term[0])[TIME_MOD(t[0] + dt)];
+                    for (unsigned int k = 0; k < nb; ++k)
+                    {
+                        if (depth[k] == 0)
+                        {
+                            prod[k]      = a2aMat.at(term[0])[TIME_MOD(t[0] + dtVec[b + k])];
+                            prodFlops[k] = 0.;
+                        }
+                    }
                     tAr.stopTimer("Disk vector overhead");
                     for (unsigned int j = 1; j < term.size() - 1; ++j)
                     {
+                        active.clear();
+                        for (unsigned int k = 0; k < nb; ++k)
+                        {
+                            if (depth[k] < j)
+                            {
+                                active.push_back(k);
+                            }
+                        }
+                        if (active.empty())
+                        {
+                            continue;
+                        }
+                        // disk vector accesses are not thread-safe, the right
+                        // operands are gathered before the batched product
                         tAr.startTimer("Disk vector overhead");
-                        const A2AMatrix<ComplexD> &ref = a2aMat.at(term[j])[TIME_MOD(t[j] + dt)];
+                        for (auto k: active)
+                        {
+                            rhs[k] = a2aMat.at(term[j])[TIME_MOD(t[j] + dtVec[b + k])];
+                        }
                         tAr.stopTimer("Disk vector overhead");
                         
                         tAr.startTimer("A*B total");
                         tAr.startTimer("A*B algebra");
-                        A2AContraction::mul(tmp, prod, ref);
+                        A2AContraction::mulBatch(tmp, prod, rhs, active, 
+                                                 j == term.size() - 2);
                         tAr.stopTimer("A*B algebra");
-                        flops += A2AContraction::mulFlops(prod, ref);
-                        prod   = tmp;
+                        for (auto k: active)
+                        {
+                            double f = A2AContraction::mulFlops(prod[k], rhs[k]);
+
+                            flops        += f;
+                            prodFlops[k] += f;
+                            prod[k].swap(tmp[k]);
+                            bytes += 3.*prod[k].rows()*prod[k].cols()*sizeof(ComplexD);
+                            memo.store(prod[k], prodFlops[k], 
+                                       ProductMemo::key(t, dtVec[b + k], j, par.global.nt));
+                        }
                         tAr.stopTimer("A*B total");
-                        bytes += 3.*tmp.rows()*tmp.cols()*sizeof(ComplexD);
                     }
+                    totalSaved += saved;
                     if (term.size() > 2)
                     {
                         std::cout << Sec(tAr.getDTimer("A*B total") - busec) << " "
                                 << Flops(flops, tAr.getDTimer("A*B algebra") - fusec) << " " 
-                                << Bytes(bytes, tAr.getDTimer("A*B total") - busec) << std::endl;
+                                << Bytes(bytes, tAr.getDTimer("A*B total") - busec) << " "
+                                << std::setw(10) << saved/1.0e9 << " GFlop saved" << std::endl;
                     }
                     std::cout << std::setw(8) << "traces";
                     flops  = 0.;
                     bytes  = 0.;
                     fusec  = tAr.getDTimer("tr(A*B)");
                     busec  = tAr.getDTimer("tr(A*B)");
+                    tAr.startTimer("tr(A*B)");
+                    A2AContraction::trMulBatch(trBuf, prod, nb, lastTerm);
+                    for (unsigned int k = 0; k < nb; ++k)
                     for (unsigned int tLast = 0; tLast < par.global.nt; ++tLast)
                     {
-                        tAr.startTimer("tr(A*B)");
-                        A2AContraction::accTrMul(result.correlator[TIME_MOD(tLast - dt)], prod, lastTerm[tLast]);
-                        tAr.stopTimer("tr(A*B)");
-                        flops += A2AContraction::accTrMulFlops(prod, lastTerm[tLast]);
-                        bytes += 2.*prod.rows()*prod.cols()*sizeof(ComplexD);
+                        result.correlator[TIME_MOD(tLast - dtVec[b + k])] += trBuf(k, tLast);
                     }
+                    tAr.stopTimer("tr(A*B)");
+                    flops += A2AContraction::trMulBatchFlops(prod, nb, lastTerm);
+                    bytes += (nb + par.global.nt)*lastTerm.rows()*sizeof(ComplexD);
                     tAr.stopTimer("Linear algebra");
                     std::cout << Sec(tAr.getDTimer("tr(A*B)") - busec) << " "
                             << Flops(flops, tAr.getDTimer("tr(A*B)") - fusec) << " " 
                             << Bytes(bytes, tAr.getDTimer("tr(A*B)") - busec) << std::endl;
                     if (!p.translationAverage)
                     {
-                        saveCorrelator(result, par.global.output, dt, traj);
+                        // the batch is accumulated in a single correlator, 
+                        // translations are saved one by one
+                        for (unsigned int k = 0; k < nb; ++k)
+                        {
+                            for (unsigned int tLast = 0; tLast < par.global.nt; ++tLast)
+                            {
+                                result.correlator[TIME_MOD(tLast - dtVec[b + k])] = trBuf(k, tLast);
+                            }
+                            saveCorrelator(result, par.global.output, dtVec[b + k], traj);
+                        }
                         for (unsigned int tLast = 0; tLast < par.global.nt; ++tLast)
                         {
                             result.correlator[tLast] = 0.;
                         }
                     }
-                    dti++;
                 }
                 if (p.translationAverage)
                 {
@@ -449,8 +903,27 @@ int main(int argc, char* argv[])
             }
             tAr.stopTimer("Total");
             printTimeProfile(tAr.getTimings(), tAr.getTimer("Total"));
+            if (term.size() > 2)
+            {
+                std::cout << "Product memo: " << memo.hits() << " hits, "
+                          << totalSaved/1.0e9 << " GFlop saved, max. memory "
+                          << memo.maxMemory()/1024./1024. << " MB" << std::endl;
+            }
+            for (auto &name: std::set<std::string>(term.begin(), term.end()))
+            {
+                auto &m = a2aMat.at(name);
+
+                m.clearPrefetch();
+                std::cout << "Disk vector '" << name << "': hit " 
+                          << m.hitRatio() << ", prefetched " 
+                          << m.prefetchHitRatio() << ", miss "
+                          << m.missRatio() << ", load " 
+                          << Sec(m.loadTime()) << ", stall " 
+                          << Sec(m.stallTime()) << std::endl;
+            }
         }
     }
+    FINALIZE();
     
     return EXIT_SUCCESS;
 }